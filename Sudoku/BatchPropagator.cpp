@@ -0,0 +1,227 @@
+/** @file BatchPropagator.cpp
+ @author agent
+ @date 10/19/2026
+ This is implementation file of a propagation engine that propagates
+	singles on a batch of puzzles in lockstep, see BatchPropagator.h.*/
+
+#include "BatchPropagator.h"
+
+// candidate mask with every value 1 to 9
+static const unsigned short allValues = 0x1FF;
+
+/** BatchPropagator Constructor
+@post every lane is empty*/
+BatchPropagator::BatchPropagator() {
+
+	load(nullptr, 0);
+
+} // end of Constructor
+
+/** status
+@param [lane] lane index, 0 to laneCount - 1
+@return the status of [lane], valid after propagate()*/
+BatchPropagator::LaneStatus BatchPropagator::status(int lane) const {
+
+	return status_[lane];
+
+} // end status
+
+/** load places up to laneCount puzzles into the lanes
+@param [puzzles] puzzles to load, [count] number of puzzles
+@post lanes past [count] are empty
+@return the number of puzzles loaded*/
+int BatchPropagator::load(Puzzle* const puzzles[], int count) {
+
+	if (count > laneCount) {
+		count = laneCount;
+	} // end if
+
+	for (int lane = 0; lane < laneCount; ++lane) {
+
+		puzzles_[lane] = (lane < count) ? puzzles[lane] : nullptr;
+		status_[lane] = LaneStatus::Empty;
+
+		char digits[SudokuTables::squareCount];
+
+		if (puzzles_[lane] != nullptr) {
+			puzzles_[lane]->getDigits(digits, '0');
+		} // end if
+
+		// empty lanes keep every candidate and never change
+		for (int square = 0; square < SudokuTables::squareCount; ++square) {
+			int value = (puzzles_[lane] != nullptr) ? digits[square] - '0' : 0;
+			candidates_[square][lane] = (value > 0) ? static_cast<unsigned short>(1 << (value - 1)) : allValues;
+		} // end for
+
+	} // end for
+
+	return count;
+
+} // end load
+
+/** propagate eliminates candidates on every lane until no lane changes
+@post status() describes every lane*/
+void BatchPropagator::propagate() {
+
+	unsigned short conflict[laneCount] = {};
+	bool changed = true;
+
+	while (changed) {
+
+		// naked singles first, they are the cheaper rule
+		while (eliminateNakedSingles()) {
+		} // end while
+
+		changed = assignHiddenSingles(conflict);
+
+	} // end while
+
+	for (int lane = 0; lane < laneCount; ++lane) {
+
+		if (puzzles_[lane] == nullptr) {
+			continue;
+		} // end if
+
+		bool solved = true;
+		bool empty = conflict[lane] != 0;
+
+		for (int square = 0; square < SudokuTables::squareCount; ++square) {
+			unsigned short mask = candidates_[square][lane];
+			empty |= mask == 0;
+			solved &= (mask & (mask - 1)) == 0;
+		} // end for
+
+		status_[lane] = empty ? LaneStatus::Unsolvable : (solved ? LaneStatus::Solved : LaneStatus::NeedsSearch);
+
+	} // end for
+
+} // end propagate
+
+/** store writes the values found by propagate() back into the puzzles
+@post every open square of a Solved or NeedsSearch puzzle that
+propagation decided has been set. Unsolvable puzzles are unchanged*/
+void BatchPropagator::store() {
+
+	for (int lane = 0; lane < laneCount; ++lane) {
+
+		if (status_[lane] != LaneStatus::Solved && status_[lane] != LaneStatus::NeedsSearch) {
+			continue;
+		} // end if
+
+		for (int square = 0; square < SudokuTables::squareCount; ++square) {
+
+			unsigned short mask = candidates_[square][lane];
+			int row = square / 9;
+			int col = square % 9;
+
+			// a single candidate in an open square
+			if ((mask & (mask - 1)) == 0 && puzzles_[lane]->get(row, col) == -1) {
+
+				int value = 1;
+				while ((mask >> (value - 1)) != 1) {
+					++value;
+				} // end while
+
+				puzzles_[lane]->set(row, col, value);
+
+			} // end if
+
+		} // end for
+
+	} // end for
+
+} // end store
+
+/** eliminateNakedSingles removes the value of every single candidate
+square from its peers, on all lanes
+@return true if any lane changed*/
+bool BatchPropagator::eliminateNakedSingles() {
+
+	unsigned short changed[laneCount] = {};
+
+	for (int square = 0; square < SudokuTables::squareCount; ++square) {
+
+		// the value of each lane where this square is decided, 0 elsewhere
+		unsigned short single[laneCount];
+		for (int lane = 0; lane < laneCount; ++lane) {
+			unsigned short mask = candidates_[square][lane];
+			single[lane] = ((mask & (mask - 1)) == 0) ? mask : 0;
+		} // end for
+
+		for (int peer = 0; peer < SudokuTables::peerCount; ++peer) {
+
+			unsigned short* peerCandidates = candidates_[sudokuTables.peers[square][peer]];
+
+			for (int lane = 0; lane < laneCount; ++lane) {
+				changed[lane] |= peerCandidates[lane] & single[lane];
+				peerCandidates[lane] &= static_cast<unsigned short>(~single[lane]);
+			} // end for
+
+		} // end for
+
+	} // end for
+
+	unsigned short any = 0;
+	for (int lane = 0; lane < laneCount; ++lane) {
+		any |= changed[lane];
+	} // end for
+
+	return any != 0;
+
+} // end eliminateNakedSingles
+
+/** assignHiddenSingles sets every value that has one place left in a
+unit, on all lanes
+@param [conflict] per lane, set to 1 if a unit misses a value or a
+square is the only place for two values
+@return true if any lane changed*/
+bool BatchPropagator::assignHiddenSingles(unsigned short conflict[]) {
+
+	unsigned short changed[laneCount] = {};
+
+	for (int unit = 0; unit < SudokuTables::unitCount; ++unit) {
+
+		const unsigned char* squares = sudokuTables.unit[unit];
+
+		// values seen at least once and at least twice in the unit
+		unsigned short once[laneCount] = {};
+		unsigned short twice[laneCount] = {};
+
+		for (int i = 0; i < SudokuTables::unitSize; ++i) {
+			const unsigned short* squareCandidates = candidates_[squares[i]];
+			for (int lane = 0; lane < laneCount; ++lane) {
+				twice[lane] |= once[lane] & squareCandidates[lane];
+				once[lane] |= squareCandidates[lane];
+			} // end for
+		} // end for
+
+		for (int lane = 0; lane < laneCount; ++lane) {
+			conflict[lane] |= once[lane] != allValues;
+			// values with exactly one place left
+			once[lane] &= static_cast<unsigned short>(~twice[lane]);
+		} // end for
+
+		for (int i = 0; i < SudokuTables::unitSize; ++i) {
+
+			unsigned short* squareCandidates = candidates_[squares[i]];
+
+			for (int lane = 0; lane < laneCount; ++lane) {
+				unsigned short hidden = squareCandidates[lane] & once[lane];
+				conflict[lane] |= (hidden & (hidden - 1)) != 0;
+				unsigned short next = hidden ? hidden : squareCandidates[lane];
+				changed[lane] |= next ^ squareCandidates[lane];
+				squareCandidates[lane] = next;
+			} // end for
+
+		} // end for
+
+	} // end for
+
+	unsigned short any = 0;
+	for (int lane = 0; lane < laneCount; ++lane) {
+		any |= changed[lane];
+	} // end for
+
+	return any != 0;
+
+} // end assignHiddenSingles
@@ -0,0 +1,85 @@
+/** @file BatchPropagator.h
+ @author agent
+ @date 10/19/2026
+ This header class file implements a propagation engine that works on
+	a batch of puzzles at once. Candidates are kept in a structure of
+	arrays layout, one lane per puzzle, and naked and hidden singles are
+	propagated on every lane in lockstep. The inner loops run across the
+	lanes so the compiler can vectorize them. Puzzles that still need
+	guessing afterwards are left to the scalar Puzzle search.*/
+
+#pragma once
+
+#include "Puzzle.h"
+
+class BatchPropagator {
+
+public:
+
+	// puzzles propagated together
+	static constexpr int laneCount = 16;
+
+	// state of a lane after propagate()
+	enum class LaneStatus {
+		Empty,			// no puzzle loaded
+		Solved,			// every square has a single candidate
+		Unsolvable,		// a square or unit ran out of candidates
+		NeedsSearch		// propagation stalled, the puzzle needs guessing
+	}; // end LaneStatus
+
+	/** BatchPropagator Constructor
+	@post every lane is empty*/
+	BatchPropagator();
+
+	/** BatchPropagator Methods*/
+
+	/** BatchPropagator Accessors */
+
+	/** status
+	@param [lane] lane index, 0 to laneCount - 1
+	@return the status of [lane], valid after propagate()*/
+	LaneStatus status(int lane) const;
+
+	/** BatchPropagator Mutators */
+
+	/** load places up to laneCount puzzles into the lanes
+	@param [puzzles] puzzles to load, [count] number of puzzles
+	@post lanes past [count] are empty
+	@return the number of puzzles loaded*/
+	int load(Puzzle* const puzzles[], int count);
+
+	/** propagate eliminates candidates on every lane until no lane changes
+	@post status() describes every lane*/
+	void propagate();
+
+	/** store writes the values found by propagate() back into the puzzles
+	@post every open square of a Solved or NeedsSearch puzzle that
+	propagation decided has been set. Unsolvable puzzles are unchanged*/
+	void store();
+
+private:
+
+	/** BatchPropagator attributes*/
+
+	// candidate bit mask per square and lane, bit v - 1 for value v
+	unsigned short candidates_[SudokuTables::squareCount][laneCount];
+	// puzzle loaded in each lane, nullptr when empty
+	Puzzle* puzzles_[laneCount];
+	// status of each lane
+	LaneStatus status_[laneCount];
+
+	/** Private Methods*/
+
+	/** eliminateNakedSingles removes the value of every single candidate
+	square from its peers, on all lanes
+	@return true if any lane changed*/
+	bool eliminateNakedSingles();
+
+	/** assignHiddenSingles sets every value that has one place left in a
+	unit, on all lanes
+	@param [conflict] per lane, set to 1 if a unit misses a value or a 
+	square is the only place for two values
+	@return true if any lane changed*/
+	bool assignHiddenSingles(unsigned short conflict[]);
+
+}; // end of BatchPropagator
@@ -0,0 +1,80 @@
+/** @file BatchWriter.cpp
+ @author agent
+ @date 10/19/2026
+ This is implementation file of a batch writer that gathers rendered
+	boards and passes them to the output stream in large writes.*/
+
+#include "BatchWriter.h"
+
+#include <cstring>
+#include "BoardFormatter.h"
+
+/** BatchWriter Constructor
+@param [out] stream receiving the batched output, [capacity] bytes
+gathered before a write, at least one grid*/
+BatchWriter::BatchWriter(std::ostream& out, size_t capacity)
+:out_(out), buffer_((capacity > BoardFormatter::gridSize) ? capacity : BoardFormatter::gridSize), used_(0) {
+} // end of Constructor
+
+/** BatchWriter Destructor
+@post every gathered byte has been written to the stream*/
+BatchWriter::~BatchWriter() {
+
+	flush();
+
+} // end of Destructor
+
+/** writeCompact gathers [puzzle] as a compact line
+@param [puzzle] the puzzle to render, see BoardFormatter::formatCompact*/
+void BatchWriter::writeCompact(const Puzzle& puzzle) {
+
+	used_ += BoardFormatter::formatCompact(puzzle, reserve(BoardFormatter::compactSize));
+
+} // end writeCompact
+
+/** writeGrid gathers [puzzle] as a grid
+@param [puzzle] the puzzle to render, see BoardFormatter::formatGrid*/
+void BatchWriter::writeGrid(const Puzzle& puzzle) {
+
+	used_ += BoardFormatter::formatGrid(puzzle, reserve(BoardFormatter::gridSize));
+
+} // end writeGrid
+
+/** write gathers raw bytes
+@param [data] bytes to write and [length] their count*/
+void BatchWriter::write(const char* data, size_t length) {
+
+	// too large to gather, pass it straight through
+	if (length > buffer_.size()) {
+		flush();
+		out_.write(data, static_cast<std::streamsize>(length));
+		return;
+	} // end if
+
+	std::memcpy(reserve(length), data, length);
+	used_ += length;
+
+} // end write
+
+/** flush writes every gathered byte to the stream*/
+void BatchWriter::flush() {
+
+	if (used_ > 0) {
+		out_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+		used_ = 0;
+	} // end if
+
+} // end flush
+
+/** reserve makes room for [length] more bytes, flushing if needed
+@param [length] bytes about to be gathered
+@return pointer to the first free byte*/
+char* BatchWriter::reserve(size_t length) {
+
+	if (buffer_.size() - used_ < length) {
+		flush();
+	} // end if
+
+	return buffer_.data() + used_;
+
+} // end reserve
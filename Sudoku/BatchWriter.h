@@ -0,0 +1,66 @@
+/** @file BatchWriter.h
+ @author agent
+ @date 10/19/2026
+ This header class file implements a batch writer that gathers many
+	rendered boards and lines in one buffer, allocated once, and passes
+	them to the output stream in large writes.*/
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "Puzzle.h"
+
+class BatchWriter {
+
+public:
+
+	/** BatchWriter Constructor
+	@param [out] stream receiving the batched output, [capacity] bytes
+	gathered before a write, at least one grid*/
+	explicit BatchWriter(std::ostream& out, size_t capacity = 1 << 16);
+
+	/** BatchWriter Destructor
+	@post every gathered byte has been written to the stream*/
+	~BatchWriter();
+
+	BatchWriter(const BatchWriter&) = delete;
+	BatchWriter& operator=(const BatchWriter&) = delete;
+
+	/** BatchWriter Methods*/
+
+	/** writeCompact gathers [puzzle] as a compact line
+	@param [puzzle] the puzzle to render, see BoardFormatter::formatCompact*/
+	void writeCompact(const Puzzle& puzzle);
+
+	/** writeGrid gathers [puzzle] as a grid
+	@param [puzzle] the puzzle to render, see BoardFormatter::formatGrid*/
+	void writeGrid(const Puzzle& puzzle);
+
+	/** write gathers raw bytes
+	@param [data] bytes to write and [length] their count*/
+	void write(const char* data, size_t length);
+
+	/** flush writes every gathered byte to the stream*/
+	void flush();
+
+private:
+
+	/** BatchWriter attributes*/
+
+	// stream receiving the output
+	std::ostream& out_;
+	// gathered bytes, sized once by the constructor
+	std::vector<char> buffer_;
+	// bytes of buffer_ in use
+	size_t used_;
+
+	/** Private Methods*/
+
+	/** reserve makes room for [length] more bytes, flushing if needed
+	@param [length] bytes about to be gathered
+	@return pointer to the first free byte*/
+	char* reserve(size_t length);
+
+}; // end of BatchWriter
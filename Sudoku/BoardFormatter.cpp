@@ -0,0 +1,71 @@
+/** @file BoardFormatter.cpp
+ @author agent
+ @date 10/19/2026
+ This is implementation file of a formatter that renders a Puzzle into
+	a caller supplied buffer in one pass, see BoardFormatter.h.*/
+
+#include "BoardFormatter.h"
+
+#include <cstring>
+
+// definitions of the buffer sizes. BatchWriter picks gridSize in a
+// conditional expression, an odr-use that needs them in C++14
+constexpr size_t BoardFormatter::compactSize;
+constexpr size_t BoardFormatter::gridSize;
+
+/** formatCompact renders [puzzle] as one line of 81 digits, 0 for
+open squares, followed by a new line
+@param [puzzle] the puzzle to render, [buffer] receives the line
+@pre [buffer] holds at least compactSize bytes
+@return the number of bytes written, compactSize*/
+size_t BoardFormatter::formatCompact(const Puzzle& puzzle, char* buffer) {
+
+	puzzle.getDigits(buffer, '0');
+	buffer[SudokuTables::squareCount] = '\n';
+
+	return compactSize;
+
+} // end formatCompact
+
+/** formatGrid renders [puzzle] in the format of operator<<, without a
+new line after the last row
+@param [puzzle] the puzzle to render, [buffer] receives the grid
+@pre [buffer] holds at least gridSize bytes
+@return the number of bytes written, gridSize*/
+size_t BoardFormatter::formatGrid(const Puzzle& puzzle, char* buffer) {
+
+	static const char sectionBreak[] = "------+-----+------\n";
+
+	char digits[SudokuTables::squareCount];
+	puzzle.getDigits(digits, ' ');
+
+	char* out = buffer;
+
+	// loop through each row
+	for (int row = 0; row < 9; ++row) {
+
+		// if row equals 3 or 6 diplay section break
+		if (row == 3 || row == 6) {
+			std::memcpy(out, sectionBreak, sizeof(sectionBreak) - 1);
+			out += sizeof(sectionBreak) - 1;
+		} // end if
+
+		const char* rowDigits = digits + row * 9;
+
+		for (int col = 0; col < 9; ++col) {
+			// section break before col 3 and 6, a space elsewhere
+			out[0] = (col == 3 || col == 6) ? '|' : ' ';
+			out[1] = rowDigits[col];
+			out += 2;
+		} // end for
+
+		// if not last row new line
+		if (row != 8) {
+			*out++ = '\n';
+		} // end if
+
+	} // end for
+
+	return static_cast<size_t>(out - buffer);
+
+} // end formatGrid
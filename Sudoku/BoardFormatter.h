@@ -0,0 +1,46 @@
+/** @file BoardFormatter.h
+ @author agent
+ @date 10/19/2026
+ This header class file implements a formatter that renders a Puzzle
+	into a caller supplied buffer in one pass, without stream operations
+	or allocations. Two formats are supported, the compact 81 character
+	line and the grid written by operator<<.*/
+
+#pragma once
+
+#include <cstddef>
+#include "Puzzle.h"
+
+class BoardFormatter {
+
+public:
+
+	// bytes written by formatCompact, 81 digits and a new line
+	static constexpr size_t compactSize = 82;
+
+	// bytes written by formatGrid, 9 rows of 18 characters, 8 new lines 
+	// between rows and 2 section breaks of 20 characters
+	static constexpr size_t gridSize = 210;
+
+	/** BoardFormatter Methods*/
+
+	/** formatCompact renders [puzzle] as one line of 81 digits, 0 for
+	open squares, followed by a new line
+	@param [puzzle] the puzzle to render, [buffer] receives the line
+	@pre [buffer] holds at least compactSize bytes
+	@return the number of bytes written, compactSize*/
+	static size_t formatCompact(const Puzzle& puzzle, char* buffer);
+
+	/** formatGrid renders [puzzle] in the format of operator<<, without a
+	new line after the last row:
+		 4 2 3|7 5 1|9 6 8
+		...
+		------+-----+------
+		...
+		 2 8 4|5 3 6|7 1 9
+	@param [puzzle] the puzzle to render, [buffer] receives the grid
+	@pre [buffer] holds at least gridSize bytes
+	@return the number of bytes written, gridSize*/
+	static size_t formatGrid(const Puzzle& puzzle, char* buffer);
+
+}; // end of BoardFormatter
@@ -0,0 +1,394 @@
+/** @file Coordinator.cpp
+ @author agent
+ @date 10/19/2026
+ This is implementation file of a local batch coordinator that runs
+	corpus shards in worker processes over pipes. Uses the POSIX process
+	and pipe interface, see SUDOKU_HAS_PROCESSES.*/
+
+#include "Coordinator.h"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <sstream>
+
+#if SUDOKU_HAS_PROCESSES
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// shards per worker that may be started ahead of the next shard to output
+static const int reorderWindow = 4;
+#endif
+
+/** Coordinator Constructor
+@param [workerCommand] program and arguments that start a worker
+reading SHARD requests on stdin, e.g. {"./sudoku", "--worker"}*/
+Coordinator::Coordinator(const std::vector<std::string>& workerCommand)
+:workerCommand_(workerCommand), workers_(1), maxAttempts_(3), retries_(0) {
+} // end of Constructor
+
+/** statistics
+@return statistics aggregated over every shard of the last run()*/
+const ShardStatistics& Coordinator::statistics() const {
+
+	return statistics_;
+
+} // end statistics
+
+/** retries
+@return the number of shards restarted during the last run()*/
+int Coordinator::retries() const {
+
+	return retries_;
+
+} // end retries
+
+/** setWorkers sets the number of concurrent worker processes
+@param [workers] worker count, values below 1 are treated as 1*/
+void Coordinator::setWorkers(int workers) {
+
+	workers_ = (workers < 1) ? 1 : workers;
+
+} // end setWorkers
+
+/** setMaxAttempts sets how often a shard is tried before giving up
+@param [attempts] attempt count, values below 1 are treated as 1*/
+void Coordinator::setMaxAttempts(int attempts) {
+
+	maxAttempts_ = (attempts < 1) ? 1 : attempts;
+
+} // end setMaxAttempts
+
+/** shardByBytes splits a corpus into byte ranges
+@param [path] corpus file, [shardBytes] bytes per shard
+@return shards covering the whole corpus, empty if it cannot be read*/
+std::vector<Coordinator::Shard> Coordinator::shardByBytes(const std::string& path, long long shardBytes) {
+
+	std::vector<Shard> shards;
+	std::ifstream corpus(path, std::ios::binary | std::ios::ate);
+
+	if (!corpus || shardBytes < 1) {
+		return shards;
+	} // end if
+
+	long long size = static_cast<long long>(corpus.tellg());
+
+	for (long long begin = 0; begin < size; begin += shardBytes) {
+		long long end = (size - begin > shardBytes) ? begin + shardBytes : size;
+		shards.push_back({ static_cast<long>(shards.size()), begin, end });
+	} // end for
+
+	return shards;
+
+} // end shardByBytes
+
+/** shardByRecords splits a corpus into ranges of whole records
+@param [path] corpus file, [shardRecords] lines per shard
+@return shards covering the whole corpus, empty if it cannot be read*/
+std::vector<Coordinator::Shard> Coordinator::shardByRecords(const std::string& path, long shardRecords) {
+
+	std::vector<Shard> shards;
+	std::ifstream corpus(path, std::ios::binary);
+
+	if (!corpus || shardRecords < 1) {
+		return shards;
+	} // end if
+
+	std::string record;
+	long count = 0; // non blank lines seen
+	long long begin = 0; // start of the current shard
+	long long start = 0; // start of the current line
+
+	while (std::getline(corpus, record)) {
+
+		// blank lines are not records, see ShardWorker::solveShard
+		if (record.find_first_not_of(" \t\r") != std::string::npos) {
+
+			// this record opens a new shard
+			if (count > 0 && count % shardRecords == 0) {
+				shards.push_back({ static_cast<long>(shards.size()), begin, start });
+				begin = start;
+			} // end if
+
+			++count;
+
+		} // end if
+
+		start += static_cast<long long>(record.size()) + 1;
+
+	} // end while
+
+	if (count > 0) {
+		shards.push_back({ static_cast<long>(shards.size()), begin, start });
+	} // end if
+
+	return shards;
+
+} // end shardByRecords
+
+#if SUDOKU_HAS_PROCESSES
+/** run, solves every shard and writes the merged results
+@param [path] corpus file, [shards] ranges of [path] to solve,
+[output] stream receiving the result lines in corpus order
+@post every result line has been written, statistics() and retries()
+describe the run. At most 4 shards per worker are started ahead of the
+next shard to output, which bounds the results held in memory
+@return true if every shard completed, false if a shard failed
+on every attempt or a worker could not be started*/
+bool Coordinator::run(const std::string& path, const std::vector<Shard>& shards, std::ostream& output) {
+
+	/** Running struct */
+	struct Running {
+		size_t shard; // index into shards
+		int pid; // worker process
+		int readFd; // read end of the worker's stdout
+		std::string reply; // everything read so far
+	}; // end Running
+
+	statistics_ = ShardStatistics();
+	retries_ = 0;
+
+	// a worker that dies before reading its request must not kill us
+	std::signal(SIGPIPE, SIG_IGN);
+
+	std::vector<std::string> results(shards.size());
+	std::vector<char> done(shards.size(), false);
+	std::vector<int> attempts(shards.size(), 0);
+	std::deque<size_t> pending;
+	std::vector<Running> running;
+	size_t nextOutput = 0; // next shard to write to output
+	bool success = true;
+
+	for (size_t i = 0; i < shards.size(); ++i) {
+		pending.push_back(i);
+	} // end for
+
+	while (success && nextOutput < shards.size()) {
+
+		// keep every worker slot busy
+		// results of shards ahead of nextOutput wait in memory, so only
+		// shards inside the reorder window are started
+		while (static_cast<int>(running.size()) < workers_ && !pending.empty()
+			&& pending.front() < nextOutput + static_cast<size_t>(reorderWindow * workers_)) {
+
+			Running worker{ pending.front(), -1, -1, std::string() };
+			pending.pop_front();
+
+			if (!launch(path, shards[worker.shard], worker.pid, worker.readFd)) {
+				std::cerr << "Cannot start worker for shard " << shards[worker.shard].id << std::endl;
+				success = false;
+				break;
+			} // end if
+
+			++attempts[worker.shard];
+			running.push_back(worker);
+
+		} // end while
+
+		if (!success || running.empty()) {
+			break;
+		} // end if
+
+		// wait for output from any worker
+		std::vector<pollfd> fds;
+		for (const Running& worker : running) {
+			fds.push_back({ worker.readFd, POLLIN, 0 });
+		} // end for
+
+		if (poll(fds.data(), fds.size(), -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			} // end if
+			success = false;
+			break;
+		} // end if
+
+		for (size_t i = running.size(); i-- > 0;) {
+
+			if (fds[i].revents == 0) {
+				continue;
+			} // end if
+
+			char buffer[4096];
+			ssize_t count = read(running[i].readFd, buffer, sizeof(buffer));
+
+			if (count > 0) {
+				running[i].reply.append(buffer, static_cast<size_t>(count));
+				continue;
+			} // end if
+
+			if (count < 0 && errno == EINTR) {
+				continue;
+			} // end if
+
+			// end of output, collect the worker
+			close(running[i].readFd);
+			int status = 0;
+			waitpid(running[i].pid, &status, 0);
+
+			size_t shard = running[i].shard;
+			ShardStatistics stats;
+
+			if (WIFEXITED(status) && WEXITSTATUS(status) == 0 
+				&& parseReply(running[i].reply, shards[shard], results[shard], stats)) {
+
+				statistics_ += stats;
+				done[shard] = true;
+
+			}
+			else if (attempts[shard] < maxAttempts_) {
+
+				// reassign the shard to a fresh worker ahead of new shards,
+				// it is holding back the output
+				++retries_;
+				pending.push_front(shard);
+
+			}
+			else {
+
+				std::cerr << "Shard " << shards[shard].id << " failed after " 
+					<< attempts[shard] << " attempt(s)" << std::endl;
+				success = false;
+
+			} // end if
+
+			running.erase(running.begin() + static_cast<long>(i));
+
+		} // end for
+
+		// write finished shards in corpus order
+		while (nextOutput < shards.size() && done[nextOutput]) {
+			output << results[nextOutput];
+			std::string().swap(results[nextOutput]);
+			++nextOutput;
+		} // end while
+
+	} // end while
+
+	// stop any worker left behind by a failed run
+	for (Running& worker : running) {
+		kill(worker.pid, SIGKILL);
+		close(worker.readFd);
+		waitpid(worker.pid, nullptr, 0);
+	} // end for
+
+	output.flush();
+	return success;
+
+} // end run
+
+/** launch starts a worker process and sends it one shard request
+@param [path] corpus file, [shard] range to solve, [pid] and [readFd]
+receive the worker process and the read end of its stdout
+@return true if the worker was started, false otherwise*/
+bool Coordinator::launch(const std::string& path, const Shard& shard, int& pid, int& readFd) const {
+
+	if (workerCommand_.empty()) {
+		return false;
+	} // end if
+
+	int toWorker[2];
+	int fromWorker[2];
+
+	if (pipe(toWorker) != 0) {
+		return false;
+	} // end if
+
+	if (pipe(fromWorker) != 0) {
+		close(toWorker[0]);
+		close(toWorker[1]);
+		return false;
+	} // end if
+
+	// keep our ends out of later workers
+	fcntl(toWorker[1], F_SETFD, FD_CLOEXEC);
+	fcntl(fromWorker[0], F_SETFD, FD_CLOEXEC);
+
+	// build argv before forking
+	std::vector<char*> arguments;
+	for (const std::string& argument : workerCommand_) {
+		arguments.push_back(const_cast<char*>(argument.c_str()));
+	} // end for
+	arguments.push_back(nullptr);
+
+	pid = fork();
+
+	if (pid < 0) {
+		close(toWorker[0]);
+		close(toWorker[1]);
+		close(fromWorker[0]);
+		close(fromWorker[1]);
+		return false;
+	} // end if
+
+	if (pid == 0) {
+		// worker process
+		dup2(toWorker[0], STDIN_FILENO);
+		dup2(fromWorker[1], STDOUT_FILENO);
+		close(toWorker[0]);
+		close(fromWorker[1]);
+		execvp(arguments[0], arguments.data());
+		_exit(127);
+	} // end if
+
+	close(toWorker[0]);
+	close(fromWorker[1]);
+
+	std::ostringstream request;
+	request << "SHARD " << shard.id << " " << shard.begin << " " 
+		<< shard.end << " " << path << "\n";
+	std::string message = request.str();
+
+	// a short write means the worker died, its reply will be rejected
+	ssize_t written = write(toWorker[1], message.data(), message.size());
+	static_cast<void>(written);
+	close(toWorker[1]);
+
+	readFd = fromWorker[0];
+	return true;
+
+} // end launch
+#endif
+
+/** parseReply checks a worker reply and splits it into results and statistics
+@param [reply] everything the worker wrote, [shard] the requested shard,
+[results] receives the result lines, [stats] receives the statistics
+@return true if [reply] is a complete answer for [shard], false otherwise*/
+bool Coordinator::parseReply(const std::string& reply, const Shard& shard, std::string& results, 
+	ShardStatistics& stats) {
+
+	std::string header = "RESULT " + std::to_string(shard.id) + "\n";
+
+	if (reply.compare(0, header.size(), header) != 0 || reply.empty() || reply.back() != '\n') {
+		return false;
+	} // end if
+
+	// the END line is the last line of the reply
+	size_t endLine = reply.rfind('\n', reply.size() - 2);
+	endLine = (endLine == std::string::npos) ? 0 : endLine + 1;
+
+	if (endLine < header.size()) {
+		return false;
+	} // end if
+
+	std::istringstream fields(reply.substr(endLine));
+	std::string command;
+	long id = -1;
+
+	fields >> command >> id >> stats.records >> stats.solved >> stats.unsolvable 
+		>> stats.invalid >> stats.micros;
+
+	if (!fields || command != "END" || id != shard.id) {
+		return false;
+	} // end if
+
+	results = reply.substr(header.size(), endLine - header.size());
+
+	// one result line per record
+	return std::count(results.begin(), results.end(), '\n') == stats.records;
+
+} // end parseReply
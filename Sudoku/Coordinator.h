@@ -0,0 +1,119 @@
+/** @file Coordinator.h
+ @author agent
+ @date 10/19/2026
+ This header class file implements a local batch coordinator. The
+	coordinator splits a puzzle corpus into shards by byte ranges or
+	record counts, runs each shard in a worker process connected over
+	pipes, retries shards whose worker crashed and merges the ordered
+	results and statistics into one output. Workers speak the line
+	protocol described in ShardWorker.h. Running workers needs the POSIX
+	process and pipe interface, elsewhere only the sharding is built.*/
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "ShardWorker.h"
+
+// worker processes are started with fork and exec and read through poll
+#if defined(__unix__) || defined(__APPLE__)
+#define SUDOKU_HAS_PROCESSES 1
+#else
+#define SUDOKU_HAS_PROCESSES 0
+#endif
+
+class Coordinator {
+
+public:
+
+	/** Shard struct
+	 byte range of the corpus handled by one worker*/
+	struct Shard {
+		long id; // position of the shard in the merged output
+		long long begin; // first byte of the range
+		long long end; // one past the last byte of the range
+	}; // end Shard
+
+	/** Coordinator Constructor
+	@param [workerCommand] program and arguments that start a worker
+	reading SHARD requests on stdin, e.g. {"./sudoku", "--worker"}*/
+	explicit Coordinator(const std::vector<std::string>& workerCommand);
+
+	/** Coordinator Methods*/
+
+	/** Coordinator Accessors */
+
+	/** statistics
+	@return statistics aggregated over every shard of the last run()*/
+	const ShardStatistics& statistics() const;
+
+	/** retries
+	@return the number of shards restarted during the last run()*/
+	int retries() const;
+
+	/** Coordinator Mutators */
+
+	/** setWorkers sets the number of concurrent worker processes
+	@param [workers] worker count, values below 1 are treated as 1*/
+	void setWorkers(int workers);
+
+	/** setMaxAttempts sets how often a shard is tried before giving up
+	@param [attempts] attempt count, values below 1 are treated as 1*/
+	void setMaxAttempts(int attempts);
+
+	/** shardByBytes splits a corpus into byte ranges
+	@param [path] corpus file, [shardBytes] bytes per shard
+	@return shards covering the whole corpus, empty if it cannot be read*/
+	static std::vector<Shard> shardByBytes(const std::string& path, long long shardBytes);
+
+	/** shardByRecords splits a corpus into ranges of whole records
+	@param [path] corpus file, [shardRecords] lines per shard
+	@return shards covering the whole corpus, empty if it cannot be read*/
+	static std::vector<Shard> shardByRecords(const std::string& path, long shardRecords);
+
+#if SUDOKU_HAS_PROCESSES
+	/** run, solves every shard and writes the merged results
+	@param [path] corpus file, [shards] ranges of [path] to solve,
+	[output] stream receiving the result lines in corpus order
+	@post every result line has been written, statistics() and retries()
+	describe the run. At most 4 shards per worker are started ahead of the
+	next shard to output, which bounds the results held in memory
+	@return true if every shard completed, false if a shard failed
+	on every attempt or a worker could not be started*/
+	bool run(const std::string& path, const std::vector<Shard>& shards, std::ostream& output);
+#endif
+
+private:
+
+	/** Coordinator attributes*/
+
+	// program and arguments that start a worker
+	std::vector<std::string> workerCommand_;
+	// number of concurrent worker processes
+	int workers_;
+	// tries per shard before the run fails
+	int maxAttempts_;
+	// statistics of the last run
+	ShardStatistics statistics_;
+	// shards restarted during the last run
+	int retries_;
+
+	/** Private Methods*/
+
+#if SUDOKU_HAS_PROCESSES
+	/** launch starts a worker process and sends it one shard request
+	@param [path] corpus file, [shard] range to solve, [pid] and [readFd]
+	receive the worker process and the read end of its stdout
+	@return true if the worker was started, false otherwise*/
+	bool launch(const std::string& path, const Shard& shard, int& pid, int& readFd) const;
+#endif
+
+	/** parseReply checks a worker reply and splits it into results and statistics
+	@param [reply] everything the worker wrote, [shard] the requested shard, 
+	[results] receives the result lines, [stats] receives the statistics
+	@return true if [reply] is a complete answer for [shard], false otherwise*/
+	static bool parseReply(const std::string& reply, const Shard& shard, std::string& results, 
+		ShardStatistics& stats);
+
+}; // end of Coordinator
@@ -0,0 +1,160 @@
+/** @file PortfolioSolver.cpp
+ @author agent
+ @date 10/19/2026
+ This is implementation file of a portfolio solver that runs several
+	differently configured Puzzle searches in parallel. The first search
+	to finish wins and the remaining searches are cancelled.*/
+
+#include "PortfolioSolver.h"
+
+#include <atomic>
+#include <thread>
+
+/** PortfolioSolver Constructor
+@post portfolio holds the default set of strategies, see
+defaultStrategies()*/
+PortfolioSolver::PortfolioSolver()
+:strategies_(defaultStrategies()), winner_(-1) {
+} // end of Constructor
+
+/** PortfolioSolver Constructor
+@param [strategies] the search strategies to run, one thread each*/
+PortfolioSolver::PortfolioSolver(const std::vector<Puzzle::Strategy>& strategies)
+:strategies_(strategies), winner_(-1) {
+} // end of Constructor
+
+/** strategyCount
+@return the number of strategies in the portfolio*/
+int PortfolioSolver::strategyCount() const {
+
+	return static_cast<int>(strategies_.size());
+
+} // end strategyCount
+
+/** winner
+@return index of the strategy that finished first during the last
+call to solve(), -1 if solve() has not been called*/
+int PortfolioSolver::winner() const {
+
+	return winner_;
+
+} // end winner
+
+/** addStrategy adds a search strategy to the portfolio
+@param [strategy] the strategy to add*/
+void PortfolioSolver::addStrategy(const Puzzle::Strategy& strategy) {
+
+	strategies_.push_back(strategy);
+
+} // end addStrategy
+
+/** solve, runs every strategy on its own copy of [puzzle]
+until one of them finishes, then cancels the rest.
+@param [puzzle] the puzzle to solve
+@post if successful, [puzzle] holds the solution found by the winner
+@return true if puzzle successfully solved, false if the winning
+search proved the puzzle has no solution */
+bool PortfolioSolver::solve(Puzzle& puzzle) {
+
+	winner_ = -1;
+
+	// no strategies, fall back to the classic search
+	if (strategies_.empty()) {
+		return puzzle.solve();
+	} // end if
+
+	// each search works on its own copy of the puzzle
+	std::vector<Puzzle> copies(strategies_.size(), puzzle);
+	// a trace is not shared between threads
+	for (Puzzle& copy : copies) {
+		copy.setTrace(nullptr);
+	} // end for
+	// results per search, only the winner's result is read
+	std::vector<char> results(strategies_.size(), false);
+	// set by the first search to finish, cancels all others
+	std::atomic<bool> finished{ false };
+	// index of the first search to finish
+	std::atomic<int> first{ -1 };
+
+	std::vector<std::thread> workers;
+	workers.reserve(strategies_.size());
+
+	try {
+
+		for (int i = 0; i < strategyCount(); ++i) {
+
+			workers.emplace_back([this, i, &copies, &results, &finished, &first]() {
+
+				results[i] = copies[i].solve(strategies_[i], &finished);
+
+				// a false result after cancellation means this search lost
+				if (!finished.exchange(true)) {
+					first.store(i);
+				} // end if
+
+			}); // end worker
+
+		} // end for
+
+	}
+	catch (...) {
+
+		// a thread could not be started, stop and join the ones that were
+		// so the vector never destroys a joinable thread
+		finished.store(true);
+		for (std::thread& worker : workers) {
+			worker.join();
+		} // end for
+
+		throw;
+
+	} // end try
+
+	for (std::thread& worker : workers) {
+		worker.join();
+	} // end for
+
+	winner_ = first.load();
+
+	if (results[winner_]) {
+		puzzle = copies[winner_];
+	} // end if
+
+	return results[winner_] != 0;
+
+} // end solve
+
+/** defaultStrategies
+@return a mix of cell heuristics, value orderings and randomized
+restarting searches suited to cutting heavy tailed run times*/
+std::vector<Puzzle::Strategy> PortfolioSolver::defaultStrategies() {
+
+	std::vector<Puzzle::Strategy> strategies(4);
+
+	// the heuristic and ordering of Puzzle::solve(), ties between equally
+	// ranked squares go to the first in row major order, so the search
+	// path can differ from Puzzle::solve(), which sorts without keeping order
+	strategies[0].cellHeuristic = Puzzle::CellHeuristic::FewestOpenPeers;
+	strategies[0].valueOrder = Puzzle::ValueOrder::Ascending;
+
+	// most constrained square first, no restarts
+	strategies[1].cellHeuristic = Puzzle::CellHeuristic::FewestCandidates;
+	strategies[1].valueOrder = Puzzle::ValueOrder::Ascending;
+
+	// randomized values and ties, short Luby restarts
+	strategies[2].cellHeuristic = Puzzle::CellHeuristic::FewestCandidates;
+	strategies[2].valueOrder = Puzzle::ValueOrder::Random;
+	strategies[2].randomTieBreak = true;
+	strategies[2].seed = 1;
+	strategies[2].restartBase = 256;
+
+	// reversed values with random ties, longer Luby restarts
+	strategies[3].cellHeuristic = Puzzle::CellHeuristic::FewestCandidates;
+	strategies[3].valueOrder = Puzzle::ValueOrder::Descending;
+	strategies[3].randomTieBreak = true;
+	strategies[3].seed = 2;
+	strategies[3].restartBase = 1024;
+
+	return strategies;
+
+} // end defaultStrategies
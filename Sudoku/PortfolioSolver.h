@@ -0,0 +1,67 @@
+/** @file PortfolioSolver.h
+ @author agent
+ @date 10/19/2026
+ This header class file implements a portfolio solver that runs several
+	differently configured Puzzle searches in parallel. The first search
+	to finish wins and the remaining searches are cancelled.*/
+
+#pragma once
+
+#include <vector>
+#include "Puzzle.h"
+
+class PortfolioSolver {
+
+public:
+
+	/** PortfolioSolver Constructor
+	@post portfolio holds the default set of strategies, see
+	defaultStrategies()*/
+	PortfolioSolver();
+
+	/** PortfolioSolver Constructor
+	@param [strategies] the search strategies to run, one thread each*/
+	explicit PortfolioSolver(const std::vector<Puzzle::Strategy>& strategies);
+
+	/** PortfolioSolver Methods*/
+
+	/** PortfolioSolver Accessors */
+
+	/** strategyCount
+	@return the number of strategies in the portfolio*/
+	int strategyCount() const;
+
+	/** winner
+	@return index of the strategy that finished first during the last 
+	call to solve(), -1 if solve() has not been called*/
+	int winner() const;
+
+	/** PortfolioSolver Mutators */
+
+	/** addStrategy adds a search strategy to the portfolio
+	@param [strategy] the strategy to add*/
+	void addStrategy(const Puzzle::Strategy& strategy);
+
+	/** solve, runs every strategy on its own copy of [puzzle]
+	until one of them finishes, then cancels the rest.
+	@param [puzzle] the puzzle to solve
+	@post if successful, [puzzle] holds the solution found by the winner
+	@return true if puzzle successfully solved, false if the winning
+	search proved the puzzle has no solution */
+	bool solve(Puzzle& puzzle);
+
+	/** defaultStrategies
+	@return a mix of cell heuristics, value orderings and randomized
+	restarting searches suited to cutting heavy tailed run times*/
+	static std::vector<Puzzle::Strategy> defaultStrategies();
+
+private:
+
+	/** PortfolioSolver attributes*/
+
+	// strategies to run, one thread per strategy
+	std::vector<Puzzle::Strategy> strategies_;
+	// index of the strategy that won the last solve, -1 if none
+	int winner_;
+
+}; // end of PortfolioSolver
@@ -6,6 +6,36 @@
 	that holds an integer value and bool value*/
 
 #include "Puzzle.h"
+#include "SearchTrace.h"
+#include "BoardFormatter.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+/** luby returns the [index]th term of the Luby restart sequence
+ 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, ...
+ @param [index] zero based position in the sequence
+ @return the multiplier for the node budget of that restart*/
+static long luby(long index) {
+
+	long size = 1; // size of the smallest complete subsequence holding index
+	int power = 0; // largest power of two in that subsequence
+
+	while (size < index + 1) {
+		++power;
+		size = 2 * size + 1;
+	} // end while
+
+	while (size - 1 != index) {
+		size = (size - 1) >> 1;
+		--power;
+		index = index % size;
+	} // end while
+
+	return 1L << power;
+
+} // end luby
 
 /** overloaded ostream method
  diplays the Puzzle object to ostream stream
@@ -26,51 +56,10 @@
 @return ostream object that represents an Puzzle */
 std::ostream& operator<<(std::ostream& out, const Puzzle& puzzle) {
 
-	// loop through each row
-	for (int row = 0; row < puzzle.defaultRowSize_; ++row) {
-		
-		// if row equals 3 or 6 diplay section break
-		if (row == 3 || row == 6) {
-			out << "------+-----+------\n";
-		} // end if
-
-		for (int col = 0; col < puzzle.defaultColSize_; ++col) {
-
-
-			// if col does not equals 3 or 6 don't display section break
-			if (col != 3 && col != 6) {
-				
-				// if get does not equal -1 then display square value
-				
-				if (puzzle.get(row, col) != -1) {
-					out << " " << puzzle.get(row, col);
-				}
-				else { // else display empty space
-					out << "  ";
-				} // end if
-
-			}
-			else {
-				
-				// if get does not equal -1 then display square value with section break
-				if (puzzle.get(row, col) != -1) {
-					out << "|" << puzzle.get(row, col);
-				}
-				else { // else display empty space with section break
-					out << "| ";
-				} // end if
-
-			} // end if
-
-
-		} // end for
-		
-		// if not last row new line
-		if (row != puzzle.defaultRowSize_ - 1) {
-			out << "\n";
-		} // end if
-
-	} // end for
+	// render the whole grid, then hand it to the stream in one write
+	char grid[BoardFormatter::gridSize];
+	size_t length = BoardFormatter::formatGrid(puzzle, grid);
+	out.write(grid, static_cast<std::streamsize>(length));
 
 	return out; // return out
 } // end of ostream friend method
@@ -125,7 +114,7 @@ std::istream& operator>>(std::istream& input, Puzzle& puzzle) {
 
 /** Puzzle Constructor*/
 Puzzle::Puzzle() 
-:size_(81) {
+:size_(81), searchNodes_(0), failedCheckpoints_(0), trace_(nullptr) {
 } // end of Constructor
 
 
@@ -135,10 +124,23 @@ Puzzle::Puzzle()
 @return the integer value at the given indices*/
 int Puzzle::get(int x, int y) const {
 	//return value at specific x/row or y/col
-	return puzzleStructure_[x][y].getValue();
+	return puzzleStructure_[x * defaultColSize_ + y].getValue();
 
 } // end of get
 
+/** getDigits writes every value of the puzzle as a character
+@param [digits] receives 81 characters in row major order, '1' to '9'
+for set squares and [blank] for open squares
+@param [blank] character written for open squares*/
+void Puzzle::getDigits(char digits[], char blank) const {
+
+	for (int square = 0; square < SudokuTables::squareCount; ++square) {
+		int value = getSquare(square).getValue();
+		digits[square] = (value > 0) ? static_cast<char>('0' + value) : blank;
+	} // end for
+
+} // end getDigits
+
 /** sets value at given row [x] and col [y] to new integer value [newValue]
 @param row index [x], and col index [y], and new value [newValue]
 @post if successful, [newValue] added at provided indices, check by
@@ -150,7 +152,7 @@ bool Puzzle::set(int x, int y, int newValue) {
 
 	if (!contains(x, y, newValue)) {
 
-		puzzleStructure_[x][y].setValue(newValue);
+		puzzleStructure_[x * defaultColSize_ + y].setValue(newValue);
 		valueSet = true;
 
 	} // end if
@@ -158,49 +160,30 @@ bool Puzzle::set(int x, int y, int newValue) {
 	return valueSet; // return valueSet
 } // end of set
 
+/** setTrace attaches a search trace to the puzzle
+@param [trace] receives an event for every square chosen, value tried,
+backtrack and solution of the searches run by this puzzle. nullptr, the
+default, disables tracing
+@post the caller keeps ownership of [trace], which must outlive the searches*/
+void Puzzle::setTrace(SearchTrace* trace) {
+
+	trace_ = trace;
+
+} // end setTrace
+
 /** contains check to see if provided value is legal to insert at provided indices
 @param [targetRow] row to be inserted at, [targetCol] col to be inserted at, and
 [value] the integer to insert
 @return True if [value] is legal to insert at specific indices, false otherwise. */
 bool Puzzle::contains(int targetRow, int targetCol, int value) const {
-	bool found = false;
 
-	// searches columns for occurrence of value
-	for (int row = 0; row < defaultRowSize_; ++row) {	
-		if (get(row, targetCol) == value) {
-			found = true; // set found to true
-			row = defaultRowSize_; // break out of loop
-		} // end if
-
-	} // end for
-
-	// searches row for occurrence of value
-
-	for (int col = 0; col < defaultColSize_; ++col) {
-
-		if (get(targetRow, col) == value) {
-			found = true; // set found to true
-			col = defaultColSize_; // break out of loop
-		} // end if
-
-	} // end for
-
-	// must search particular 3*3 matrix,
-	//starting row position
-	int startRowPos = targetRow - targetRow % 3;
-	//starting column position
-	int startColPos = targetCol - targetCol % 3;
-
-	for (int i = 0; i < 3; i++) {
-		
-		for (int j = 0; j < 3; j++) {
-			
-			if (get((i + startRowPos), (j + startColPos)) == value) {
-				found = true; // set found to true
-			} // end if
-
-		} // end for
+	int target = targetRow * defaultColSize_ + targetCol;
+	bool found = getSquare(target).getValue() == value;
 
+	// searches the row, column and 3*3 matrix through the peer table
+	SUDOKU_UNROLL
+	for (int peer = 0; peer < SudokuTables::peerCount; ++peer) {
+		found |= getSquare(sudokuTables.peers[target][peer]).getValue() == value;
 	} // end for
 
 	return found; // return found
@@ -222,21 +205,22 @@ int Puzzle::numEmpty() const {
 	// holds open space count
 	int openSpaceCount = 0;
 
-	for (int row = 0; row < defaultRowSize_; ++row) {
-		
-		for (int col = 0; col < defaultColSize_; ++col) {
-			
-			if (get(row, col) < 0) {
-				++openSpaceCount;
-			} // end if
-
-		} // end for
-
+	for (int square = 0; square < SudokuTables::squareCount; ++square) {
+		openSpaceCount += getSquare(square).getValue() < 0;
 	} // end for
 
 	return openSpaceCount; // return open space count
 } // end numEmpty
 
+/** failedCheckpoints returns the number of timed checkpoints the last
+solveResumable() or resume() could not write
+@return integer number of checkpoints lost since the search started*/
+long Puzzle::failedCheckpoints() const {
+
+	return failedCheckpoints_;
+
+} // end failedCheckpoints
+
 /** solve, solves the provided puzzle stating at the provided indices
 recursively using backtracking.
 @param [row] and [col] starting indices
@@ -247,6 +231,10 @@ bool Puzzle::solve(int row, int col) {
 	
 	// base case
 	if (numEmpty() == 0) {
+
+		if (trace_ != nullptr) {
+			trace_->record(SearchTrace::EventType::Solved, row, col, 0);
+		} // end if
 		
 		return true; // return true/success
 
@@ -255,12 +243,20 @@ bool Puzzle::solve(int row, int col) {
 	//Move to next square without a value
 	moveToHardestSquare(row, col);
 
+	if (trace_ != nullptr) {
+		trace_->record(SearchTrace::EventType::Choose, row, col, countCandidates(row, col));
+	} // end if
+
 	for (int i = 1; i < 10; ++i) {
 		
 		//check if legal move
 		//if legel value is set
 		if (set(row, col, i)) {
 
+			if (trace_ != nullptr) {
+				trace_->record(SearchTrace::EventType::Try, row, col, i);
+			} // end if
+
 			if (solve(row, col)) {
 				return true; // return true/success
 			} // end if
@@ -269,12 +265,16 @@ bool Puzzle::solve(int row, int col) {
 
 		// remove incorrect value;
 		// don't remove fixed values
-		if (!puzzleStructure_[row][col].getFixed()) {
-			puzzleStructure_[row][col].setValue(0);
+		if (!puzzleStructure_[row * defaultColSize_ + col].getFixed()) {
+			puzzleStructure_[row * defaultColSize_ + col].setValue(0);
 		} // end if	
 
 	} // end for
 
+	if (trace_ != nullptr) {
+		trace_->record(SearchTrace::EventType::Backtrack, row, col, 0);
+	} // end if
+
 	// no values valid in current square, previous square is invalid
 	return false;
 
@@ -290,6 +290,144 @@ bool Puzzle::solve() {
 
 } // end solve
 
+/** solve, solves the provided puzzle using the given search [strategy],
+restarting the search whenever the strategy's node budget runs out.
+@param [strategy] search configuration, [cancel] optional flag that
+aborts the search once set to true, may be nullptr
+@post if successful, the provided sudoku puzzle has been solved,
+otherwise all variable squares are left open
+@return true if puzzle successfully solved, false if the puzzle has
+no solution or the search was cancelled */
+bool Puzzle::solve(const Strategy& strategy, const std::atomic<bool>* cancel) {
+
+	std::mt19937 generator(strategy.seed);
+
+	for (long run = 0; ; ++run) {
+
+		// node budget for this run, negative means unlimited
+		long nodeBudget = (strategy.restartBase > 0) ? strategy.restartBase * luby(run) : -1;
+
+		if (search(strategy, generator, nodeBudget, cancel)) {
+			return true; // return true/success
+		} // end if
+
+		// the run finished inside its budget, the whole tree was explored
+		if (nodeBudget != 0 || (cancel != nullptr && cancel->load(std::memory_order_relaxed))) {
+			return false;
+		} // end if
+
+	} // end for
+
+} // end solve
+
+/** solveResumable, solves the provided puzzle with the same search as
+solve() but keeps the branching stack on the heap so it can be saved.
+@param [checkpointPath] file receiving the search state, may be empty,
+[interval] nodes between checkpoints, 0 never saves on a timer,
+[suspend] optional flag, once set to true the search state is saved
+and the search stops, may be nullptr
+@post the search state is written to [checkpointPath] when the search
+starts, every [interval] nodes and when suspended, and removed once the
+search finishes. if successful the puzzle has been solved.
+a failed timed checkpoint is counted in failedCheckpoints() and the
+search goes on
+@return Solved, NoSolution, Suspended, or SaveFailed if the state
+could not be written when suspending */
+Puzzle::SearchStatus Puzzle::solveResumable(const std::string& checkpointPath, long interval, 
+	const std::atomic<bool>* suspend) {
+
+	searchStack_.clear();
+	searchNodes_ = 0;
+	failedCheckpoints_ = 0;
+
+	// base case
+	if (numEmpty() == 0) {
+		removeCheckpoint(checkpointPath);
+		return SearchStatus::Solved;
+	} // end if
+
+	// branch on the first square
+	int row = 0;
+	int col = 0;
+	moveToHardestSquare(row, col);
+	searchStack_.push_back({ row, col, 1 });
+
+	if (trace_ != nullptr) {
+		trace_->record(SearchTrace::EventType::Choose, row, col, countCandidates(row, col));
+	} // end if
+
+	// replace the checkpoint of an earlier puzzle right away,
+	// or drop it so it cannot be resumed in place of this one
+	if (!checkpointPath.empty() && !writeCheckpoint(checkpointPath)) {
+		++failedCheckpoints_;
+		removeCheckpoint(checkpointPath);
+	} // end if
+
+	return runSearch(checkpointPath, interval, suspend);
+
+} // end solveResumable
+
+/** resume, loads a checkpoint written by solveResumable() and continues
+the search exactly where it stopped.
+@param [checkpointPath] file holding the search state, also receives
+later checkpoints, [interval] and [suspend] as for solveResumable()
+@post puzzle holds the board of the checkpoint, see solveResumable()
+throws runtime_error if the checkpoint cannot be read
+@return Solved, NoSolution, Suspended or SaveFailed */
+Puzzle::SearchStatus Puzzle::resume(const std::string& checkpointPath, long interval, 
+	const std::atomic<bool>* suspend) {
+
+	if (!readCheckpoint(checkpointPath)) {
+
+		throw std::runtime_error("None Valid Checkpoint Provided, Search Did Not Resume");
+
+	} // end if
+
+	if (searchStack_.empty()) {
+		removeCheckpoint(checkpointPath);
+		return (numEmpty() == 0) ? SearchStatus::Solved : SearchStatus::NoSolution;
+	} // end if
+
+	if (trace_ != nullptr) {
+		traceRestoredStack();
+	} // end if
+
+	return runSearch(checkpointPath, interval, suspend);
+
+} // end resume
+
+/** traceRestoredStack records the levels of a restored searchStack_ as
+if they had just been searched, so the trace starts at the right depth
+@post the board is unchanged, trace_ holds a Choose event per level and
+a Try event for the value set on every level but the top*/
+void Puzzle::traceRestoredStack() {
+
+	const SearchFrame& top = searchStack_.back();
+	Square& topSquare = puzzleStructure_[top.row * defaultColSize_ + top.col];
+	// the top square may still hold the value it tried last
+	int topValue = topSquare.getValue();
+
+	// replay from an empty path so candidate counts match the original search
+	for (const SearchFrame& frame : searchStack_) {
+		puzzleStructure_[frame.row * defaultColSize_ + frame.col].setValue(0);
+	} // end for
+
+	for (size_t level = 0; level < searchStack_.size(); ++level) {
+
+		const SearchFrame& frame = searchStack_[level];
+		trace_->record(SearchTrace::EventType::Choose, frame.row, frame.col, countCandidates(frame.row, frame.col));
+
+		if (level + 1 < searchStack_.size()) {
+			puzzleStructure_[frame.row * defaultColSize_ + frame.col].setValue(frame.nextValue - 1);
+			trace_->record(SearchTrace::EventType::Try, frame.row, frame.col, frame.nextValue - 1);
+		} // end if
+
+	} // end for
+
+	topSquare.setValue((topValue > 0) ? topValue : 0);
+
+} // end traceRestoredStack
+
 /** clear resets all square objects to default values and size_
 @post all Sqaure objects in the puzzle contain a value of -1, false
 for fixed_, and size_ reset to 81*/
@@ -301,7 +439,7 @@ void Puzzle::clear() {
 		//loop through each column
 		for (int col = 0; col < defaultColSize_; ++col) {
 
-			puzzleStructure_[row][col].resetSquare();
+			puzzleStructure_[row * defaultColSize_ + col].resetSquare();
 
 		} // end for
 
@@ -310,6 +448,11 @@ void Puzzle::clear() {
 	// reset size of Puzzle object
 	size_ = 81; 
 
+	// forget any suspended search
+	searchStack_.clear();
+	searchNodes_ = 0;
+	failedCheckpoints_ = 0;
+
 } // end clear
 
 /** getOptions get the amount of options for the given sqaure
@@ -317,39 +460,18 @@ void Puzzle::clear() {
 @return the count of options for the given sqaure*/
 int Puzzle::getOptions(int targetRow, int targetCol) const {
 
+	int target = targetRow * defaultColSize_ + targetCol;
 	int optionCount = 0;
-	// count open columns for target sqaure
-	for (int row = 0; row < defaultRowSize_; ++row) {
-		
-		if (get(row, targetCol) == -1) {
-			++optionCount; 
-		} // end if	
 
-	} // end for
+	// count open squares in the row, column and 3*3 matrix of the target,
+	// the target itself and squares shared by two units count once per unit
+	for (int unit = 0; unit < SudokuTables::unitsPerSquare; ++unit) {
 
-	// count open row for target sqaure
-	for (int col = 0; col < defaultColSize_; ++col) {
-		
-		if (get(targetRow, col) == -1) {
-			++optionCount;
-		} // end if
-
-	} // end for
-
-	// must search particular 3*3 matrix,
-	//starting row position
-	int startRowPos = targetRow - targetRow % 3;
-	//starting column position
-	int startColPos = targetCol - targetCol % 3;
-
-	for (int i = 0; i < 3; i++) {
-
-		for (int j = 0; j < 3; j++) {
-			
-			if (get((i + startRowPos), (j + startColPos)) == -1) {
-				++optionCount;
-			} // end if
+		const unsigned char* squares = sudokuTables.unit[sudokuTables.unitsOf[target][unit]];
 
+		SUDOKU_UNROLL
+		for (int i = 0; i < SudokuTables::unitSize; ++i) {
+			optionCount += getSquare(squares[i]).getValue() == -1;
 		} // end for
 
 	} // end for
@@ -427,6 +549,417 @@ void Puzzle::moveToHardestSquare(int& row, int& col) {
 
 }// end moveToEmptySquare
 
+/** runSearch, continues the search held in searchStack_
+@param [checkpointPath], [interval] and [suspend] as for solveResumable()
+@return Solved, NoSolution, Suspended or SaveFailed */
+Puzzle::SearchStatus Puzzle::runSearch(const std::string& checkpointPath, long interval, 
+	const std::atomic<bool>* suspend) {
+
+	// node count at the last checkpoint
+	long long lastCheckpoint = searchNodes_;
+
+	while (!searchStack_.empty()) {
+
+		// the stack and board are consistent here, save them if asked to
+		if (suspend != nullptr && suspend->load()) {
+
+			// without a saved state the work would be lost
+			if (!checkpointPath.empty() && !writeCheckpoint(checkpointPath)) {
+				return SearchStatus::SaveFailed;
+			} // end if
+
+			return SearchStatus::Suspended;
+
+		} // end if
+
+		if (interval > 0 && !checkpointPath.empty() && searchNodes_ - lastCheckpoint >= interval) {
+
+			if (!writeCheckpoint(checkpointPath)) {
+				++failedCheckpoints_;
+			} // end if
+
+			lastCheckpoint = searchNodes_;
+
+		} // end if
+
+		SearchFrame& top = searchStack_.back();
+
+		// remove the value tried last at this square
+		puzzleStructure_[top.row * defaultColSize_ + top.col].setValue(0);
+
+		// find the next legal value
+		int value = top.nextValue;
+		while (value < 10 && !set(top.row, top.col, value)) {
+			++value;
+		} // end while
+
+		// no values valid in current square, previous square is invalid
+		if (value == 10) {
+
+			if (trace_ != nullptr) {
+				trace_->record(SearchTrace::EventType::Backtrack, top.row, top.col, 0);
+			} // end if
+
+			searchStack_.pop_back();
+			continue;
+
+		} // end if
+
+		top.nextValue = value + 1;
+		++searchNodes_;
+
+		if (trace_ != nullptr) {
+			trace_->record(SearchTrace::EventType::Try, top.row, top.col, value);
+		} // end if
+
+		if (numEmpty() == 0) {
+
+			if (trace_ != nullptr) {
+				trace_->record(SearchTrace::EventType::Solved, top.row, top.col, 0);
+			} // end if
+
+			searchStack_.clear();
+			removeCheckpoint(checkpointPath);
+			return SearchStatus::Solved;
+
+		} // end if
+
+		//Move to next square without a value
+		int row = top.row;
+		int col = top.col;
+		moveToHardestSquare(row, col);
+		searchStack_.push_back({ row, col, 1 });
+
+		if (trace_ != nullptr) {
+			trace_->record(SearchTrace::EventType::Choose, row, col, countCandidates(row, col));
+		} // end if
+
+	} // end while
+
+	removeCheckpoint(checkpointPath);
+	return SearchStatus::NoSolution;
+
+} // end runSearch
+
+/** writeCheckpoint saves the board, fixed mask and searchStack_
+ File layout, all integers little endian:
+	4 bytes		"SDKC"
+	1 byte		format version, 1
+	81 bytes	board, row major, 0 for an open square
+	11 bytes	fixed mask, bit i set if square i is fixed
+	1 byte		size_
+	8 bytes		searchNodes_
+	1 byte		depth of searchStack_
+	2 bytes		per level, square index and next value to try
+@param [checkpointPath] file to write, replaced atomically
+@return true if the checkpoint was written, false otherwise*/
+bool Puzzle::writeCheckpoint(const std::string& checkpointPath) const {
+
+	const int squares = defaultRowSize_ * defaultColSize_;
+	std::string data("SDKC\x01", 5);
+
+	// board
+	for (int i = 0; i < squares; ++i) {
+		int value = get(i / defaultColSize_, i % defaultColSize_);
+		data.push_back(static_cast<char>(value > 0 ? value : 0));
+	} // end for
+
+	// fixed mask
+	std::string mask((squares + 7) / 8, '\0');
+	for (int i = 0; i < squares; ++i) {
+		if (puzzleStructure_[i].getFixed()) {
+			mask[i / 8] = static_cast<char>(mask[i / 8] | (1 << (i % 8)));
+		} // end if
+	} // end for
+	data += mask;
+
+	data.push_back(static_cast<char>(size_));
+
+	for (int byte = 0; byte < 8; ++byte) {
+		data.push_back(static_cast<char>((searchNodes_ >> (8 * byte)) & 0xFF));
+	} // end for
+
+	// branching stack
+	data.push_back(static_cast<char>(searchStack_.size()));
+	for (const SearchFrame& frame : searchStack_) {
+		data.push_back(static_cast<char>(frame.row * defaultColSize_ + frame.col));
+		data.push_back(static_cast<char>(frame.nextValue));
+	} // end for
+
+	// write beside the old checkpoint, then replace it
+	std::string tempPath = checkpointPath + ".tmp";
+	std::ofstream output(tempPath, std::ios::binary | std::ios::trunc);
+	output.write(data.data(), static_cast<std::streamsize>(data.size()));
+	output.close();
+
+	if (!output) {
+		std::remove(tempPath.c_str());
+		return false;
+	} // end if
+
+	return std::rename(tempPath.c_str(), checkpointPath.c_str()) == 0;
+
+} // end writeCheckpoint
+
+/** readCheckpoint restores the board, fixed mask and searchStack_
+@param [checkpointPath] file written by writeCheckpoint()
+@return true if a valid checkpoint was read, false otherwise*/
+bool Puzzle::readCheckpoint(const std::string& checkpointPath) {
+
+	const int squares = defaultRowSize_ * defaultColSize_;
+	const int headerSize = 5 + squares + (squares + 7) / 8 + 1 + 8 + 1;
+
+	std::ifstream input(checkpointPath, std::ios::binary);
+	std::string data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+	if (static_cast<int>(data.size()) < headerSize || data.compare(0, 5, std::string("SDKC\x01", 5)) != 0) {
+		return false;
+	} // end if
+
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data.data());
+	const unsigned char* board = bytes + 5;
+	const unsigned char* mask = board + squares;
+	int size = bytes[headerSize - 10];
+	int depth = bytes[headerSize - 1];
+
+	if (static_cast<int>(data.size()) != headerSize + 2 * depth || size > squares || depth > squares) {
+		return false;
+	} // end if
+
+	// validate every square before changing the puzzle, rebuilding the
+	// board in a scratch puzzle so contains() rejects broken rules as fill() does
+	Puzzle restored;
+	for (int i = 0; i < squares; ++i) {
+
+		bool fixed = (mask[i / 8] >> (i % 8)) & 1;
+		if (board[i] > 9 || (fixed && board[i] == 0)) {
+			return false;
+		} // end if
+
+		if (board[i] != 0) {
+
+			if (restored.contains(i / defaultColSize_, i % defaultColSize_, board[i])) {
+				return false;
+			} // end if
+
+			restored.puzzleStructure_[i].setValue(board[i]);
+
+		} // end if
+
+	} // end for
+
+	std::vector<SearchFrame> stack;
+	for (int level = 0; level < depth; ++level) {
+
+		int square = bytes[headerSize + 2 * level];
+		int nextValue = bytes[headerSize + 2 * level + 1];
+
+		if (square >= squares || nextValue < 1 || nextValue > 10 || ((mask[square / 8] >> (square % 8)) & 1)) {
+			return false;
+		} // end if
+
+		// every level holds the value tried last, only the top level
+		// may still be open before its first value is tried
+		bool open = board[square] == 0 && nextValue == 1 && level == depth - 1;
+		if (board[square] != nextValue - 1 && !open) {
+			return false;
+		} // end if
+
+		stack.push_back({ square / defaultColSize_, square % defaultColSize_, nextValue });
+
+	} // end for
+
+	clear();
+
+	for (int i = 0; i < squares; ++i) {
+		Square& square = puzzleStructure_[i];
+		square.setValue(board[i]);
+		square.setFixed((mask[i / 8] >> (i % 8)) & 1);
+	} // end for
+
+	size_ = size;
+	searchNodes_ = 0;
+	for (int byte = 0; byte < 8; ++byte) {
+		searchNodes_ |= static_cast<long long>(bytes[headerSize - 9 + byte]) << (8 * byte);
+	} // end for
+	searchStack_ = stack;
+
+	return true;
+
+} // end readCheckpoint
+
+/** removeCheckpoint deletes the checkpoint of a finished search
+@param [checkpointPath] file written by writeCheckpoint(), may be empty
+@post no checkpoint is left at [checkpointPath]*/
+void Puzzle::removeCheckpoint(const std::string& checkpointPath) const {
+
+	if (!checkpointPath.empty()) {
+		std::remove(checkpointPath.c_str());
+	} // end if
+
+} // end removeCheckpoint
+
+/** countCandidates counts the legal values for the given sqaure
+@param [targetRow] and [targetCol], indices of the current sqaure
+@return the count of values 1-9 that may be set at the given sqaure*/
+int Puzzle::countCandidates(int targetRow, int targetCol) const {
+
+	int target = targetRow * defaultColSize_ + targetCol;
+
+	// bit v is set once value v is seen, open squares (-1) set bit 15
+	unsigned int used = 1u << (getSquare(target).getValue() & 15);
+
+	SUDOKU_UNROLL
+	for (int peer = 0; peer < SudokuTables::peerCount; ++peer) {
+		used |= 1u << (getSquare(sudokuTables.peers[target][peer]).getValue() & 15);
+	} // end for
+
+	int candidateCount = 0;
+
+	for (int value = 1; value < 10; ++value) {
+		candidateCount += ((used >> value) & 1u) == 0;
+	} // end for
+
+	return candidateCount; // return candidateCount
+
+} // end countCandidates
+
+/** moveToSquare Searches for next open space using the
+cell heuristic of the provided [strategy]
+@param [strategy] search configuration, [generator] random engine for
+tie breaks, [row] and [col] passed by reference, indices to update
+@post updates [row] and [col] to the chosen open space
+@return false if no open space exists, true otherwise*/
+bool Puzzle::moveToSquare(const Strategy& strategy, std::mt19937& generator, int& row, int& col) const {
+
+	int bestRank = 0; // rank of the chosen square, lower is better
+	int ties = 0; // count of squares sharing bestRank
+
+	// loop through each row
+	for (int i = 0; i < defaultRowSize_; ++i) {
+		// loop through each col
+		for (int j = 0; j < defaultColSize_; ++j) {
+
+			if (get(i, j) != -1) {
+				continue; // not an open space
+			} // end if
+
+			if (strategy.cellHeuristic == CellHeuristic::FirstOpen) {
+				row = i;
+				col = j;
+				return true;
+			} // end if
+
+			int rank = (strategy.cellHeuristic == CellHeuristic::FewestCandidates)
+				? countCandidates(i, j) : getOptions(i, j);
+
+			if (ties == 0 || rank < bestRank) {
+				bestRank = rank;
+				ties = 1;
+				row = i;
+				col = j;
+			}
+			else if (rank == bestRank && strategy.randomTieBreak) {
+				// reservoir sample so every tied square is equally likely
+				++ties;
+				if (generator() % ties == 0) {
+					row = i;
+					col = j;
+				} // end if
+			} // end if
+
+			// a square without candidates is a dead end, stop looking
+			if (rank == 0 && strategy.cellHeuristic == CellHeuristic::FewestCandidates) {
+				return true;
+			} // end if
+
+		} // end for
+
+	} // end for
+
+	return ties > 0;
+
+} // end moveToSquare
+
+/** search, single run of the configurable backtracking search
+@param [strategy] search configuration, [generator] random engine,
+[nodeBudget] remaining nodes for this run, negative for unlimited,
+[cancel] optional cancellation flag
+@post on failure every value set by this run has been removed
+@return true if puzzle successfully solved, otherwise false */
+bool Puzzle::search(const Strategy& strategy, std::mt19937& generator, long& nodeBudget, 
+	const std::atomic<bool>* cancel) {
+
+	int row = 0;
+	int col = 0;
+
+	// base case, no open space left
+	if (!moveToSquare(strategy, generator, row, col)) {
+
+		if (trace_ != nullptr) {
+			trace_->record(SearchTrace::EventType::Solved, row, col, 0);
+		} // end if
+
+		return true; // return true/success
+
+	} // end if
+
+	// out of budget or another search finished first
+	if (nodeBudget == 0 || (cancel != nullptr && cancel->load(std::memory_order_relaxed))) {
+		return false;
+	} // end if
+
+	if (nodeBudget > 0) {
+		--nodeBudget;
+	} // end if
+
+	if (trace_ != nullptr) {
+		trace_->record(SearchTrace::EventType::Choose, row, col, countCandidates(row, col));
+	} // end if
+
+	// values to try in order
+	int values[9] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	if (strategy.valueOrder == ValueOrder::Descending) {
+		std::reverse(std::begin(values), std::end(values));
+	}
+	else if (strategy.valueOrder == ValueOrder::Random) {
+		std::shuffle(std::begin(values), std::end(values), generator);
+	} // end if
+
+	for (int value : values) {
+
+		if (set(row, col, value)) {
+
+			if (trace_ != nullptr) {
+				trace_->record(SearchTrace::EventType::Try, row, col, value);
+			} // end if
+
+			if (search(strategy, generator, nodeBudget, cancel)) {
+				return true; // return true/success
+			} // end if
+
+			// remove incorrect value
+			puzzleStructure_[row * defaultColSize_ + col].setValue(0);
+
+			// stop trying values once the run is aborted
+			if (nodeBudget == 0 || (cancel != nullptr && cancel->load(std::memory_order_relaxed))) {
+				break;
+			} // end if
+
+		} // end if
+
+	} // end for
+
+	if (trace_ != nullptr) {
+		trace_->record(SearchTrace::EventType::Backtrack, row, col, 0);
+	} // end if
+
+	// no values valid in current square, previous square is invalid
+	return false;
+
+} // end search
+
 /** fill
 @param inputData[] holding 81 integer values
 @post If successful 81 integer values are inserted into Puzzle Squares,
@@ -448,8 +981,8 @@ bool Puzzle::fill(const int inputData[]) {
 
 				if (!contains(row, col, inputData[inputIndex])) {
 
-					puzzleStructure_[row][col].setValue(inputData[inputIndex]);
-					puzzleStructure_[row][col].setFixed(true);
+					puzzleStructure_[row * defaultColSize_ + col].setValue(inputData[inputIndex]);
+					puzzleStructure_[row * defaultColSize_ + col].setFixed(true);
 					++inputIndex;
 
 				}
@@ -464,7 +997,7 @@ bool Puzzle::fill(const int inputData[]) {
 			}
 			else { // Blank Space
 
-				puzzleStructure_[row][col].setValue(inputData[inputIndex]);
+				puzzleStructure_[row * defaultColSize_ + col].setValue(inputData[inputIndex]);
 				++inputIndex;
 
 			} // end if
@@ -487,14 +1020,6 @@ Puzzle::Square::Square(int value, bool fixed)
 
 
 
-/** getValue
-@return integer value stored in value_*/
-int Puzzle::Square::getValue() const {
-	
-	return ((value_ > 0) ? value_ : (-1));
-
-} // end of getValue()
-
 /** getfixed
 @return bool value stored in fixed_*/
 bool Puzzle::Square::getFixed() const {
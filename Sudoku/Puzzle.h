@@ -14,6 +14,11 @@
 #include <queue>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <random>
+#include "SudokuTables.h"
+
+class SearchTrace;
 
 class Puzzle{
 
@@ -52,6 +57,49 @@ class Puzzle{
 
 public:
 
+	/** Search Strategy */
+
+	// how the next open square is chosen while searching
+	enum class CellHeuristic {
+		FewestOpenPeers,	// open square with the fewest open peers, see getOptions()
+		FewestCandidates,	// open square with the fewest legal values
+		FirstOpen			// first open square in row major order
+	}; // end CellHeuristic
+
+	// the order values are tried in at each open square
+	enum class ValueOrder {
+		Ascending,	// 1 to 9
+		Descending,	// 9 to 1
+		Random		// shuffled per square using the strategy seed
+	}; // end ValueOrder
+
+	/** Strategy struct
+	 configures a single backtracking search, used by solve(strategy, cancel)
+	 and by the PortfolioSolver to run differently configured searches */
+	struct Strategy {
+
+		// cell heuristic used to pick the next square
+		CellHeuristic cellHeuristic = CellHeuristic::FewestOpenPeers;
+		// value ordering used at each square
+		ValueOrder valueOrder = ValueOrder::Ascending;
+		// if true, ties between equally ranked squares are broken at random
+		bool randomTieBreak = false;
+		// seed for the random tie breaks and value shuffles
+		unsigned int seed = 0;
+		// node budget of the first run, later runs follow the Luby sequence 
+		// (1, 1, 2, 1, 1, 2, 4, ...) times this value. 0 never restarts
+		long restartBase = 0;
+
+	}; // end Strategy
+
+	// outcome of a search that can be suspended, see solveResumable()
+	enum class SearchStatus {
+		Solved,		// the puzzle has been solved
+		NoSolution,	// the whole search tree was explored
+		Suspended,	// the search state was saved and the search stopped
+		SaveFailed	// suspending was asked for but the state could not be saved
+	}; // end SearchStatus
+
 	/** Puzzle Constructor */
 	Puzzle();
 
@@ -64,9 +112,22 @@ public:
 	@return the integer value at the given indices*/
 	int get(int x, int y) const;
 
+	/** getDigits writes every value of the puzzle as a character
+	@param [digits] receives 81 characters in row major order, '1' to '9'
+	for set squares and [blank] for open squares
+	@param [blank] character written for open squares*/
+	void getDigits(char digits[], char blank = '0') const;
+
 
 	/** Puzzle Mutators */
 
+	/** setTrace attaches a search trace to the puzzle
+	@param [trace] receives an event for every square chosen, value tried,
+	backtrack and solution of the searches run by this puzzle. nullptr, the
+	default, disables tracing
+	@post the caller keeps ownership of [trace], which must outlive the searches*/
+	void setTrace(SearchTrace* trace);
+
 	/** sets value at given row [x] and col [y] to new integer value [newValue]
 	@param row index [x], and col index [y], and new value [newValue]
 	@post if successful, [newValue] added at provided indices, check by
@@ -89,6 +150,11 @@ public:
 	@return integer number that represents the number of current open spaces*/
 	int numEmpty() const;
 
+	/** failedCheckpoints returns the number of timed checkpoints the last
+	solveResumable() or resume() could not write
+	@return integer number of checkpoints lost since the search started*/
+	long failedCheckpoints() const;
+
 	/** solve, solves the provided puzzle stating at the provided indices
 	recursively using backtracking. 
 	@param [row] and [col] starting indices
@@ -103,6 +169,42 @@ public:
 	@return true if puzzle successfully solved, otherwise false */
 	bool solve();
 
+	/** solve, solves the provided puzzle using the given search [strategy],
+	restarting the search whenever the strategy's node budget runs out.
+	@param [strategy] search configuration, [cancel] optional flag that
+	aborts the search once set to true, may be nullptr
+	@post if successful, the provided sudoku puzzle has been solved,
+	otherwise all variable squares are left open
+	@return true if puzzle successfully solved, false if the puzzle has
+	no solution or the search was cancelled */
+	bool solve(const Strategy& strategy, const std::atomic<bool>* cancel = nullptr);
+
+	/** solveResumable, solves the provided puzzle with the same search as
+	solve() but keeps the branching stack on the heap so it can be saved.
+	@param [checkpointPath] file receiving the search state, may be empty,
+	[interval] nodes between checkpoints, 0 never saves on a timer,
+	[suspend] optional flag, once set to true the search state is saved
+	and the search stops, may be nullptr
+	@post the search state is written to [checkpointPath] when the search
+	starts, every [interval] nodes and when suspended, and removed once the
+	search finishes. if successful the puzzle has been solved.
+	a failed timed checkpoint is counted in failedCheckpoints() and the
+	search goes on
+	@return Solved, NoSolution, Suspended, or SaveFailed if the state
+	could not be written when suspending */
+	SearchStatus solveResumable(const std::string& checkpointPath, long interval = 0, 
+		const std::atomic<bool>* suspend = nullptr);
+
+	/** resume, loads a checkpoint written by solveResumable() and continues
+	the search exactly where it stopped.
+	@param [checkpointPath] file holding the search state, also receives
+	later checkpoints, [interval] and [suspend] as for solveResumable()
+	@post puzzle holds the board of the checkpoint, see solveResumable()
+	throws runtime_error if the checkpoint cannot be read
+	@return Solved, NoSolution, Suspended or SaveFailed */
+	SearchStatus resume(const std::string& checkpointPath, long interval = 0, 
+		const std::atomic<bool>* suspend = nullptr);
+
 
 	/** clear resets all square objects to default values and size_
 	@post all Sqaure objects in the puzzle contain a value of -1, false 
@@ -170,8 +272,27 @@ private:
 	// Fixed column size of puzzle.
 	static const int defaultColSize_ = 9;
 
-	// Puzzle data structure
-	Square puzzleStructure_ [defaultRowSize_][defaultColSize_];
+	// Puzzle data structure, row major, square [row][col] is at
+	// index row * defaultColSize_ + col to match the SudokuTables indices
+	Square puzzleStructure_ [defaultRowSize_ * defaultColSize_];
+
+	/** SearchFrame struct
+	 one level of the search run by solveResumable()*/
+	struct SearchFrame {
+		int row; // row of the square branched on
+		int col; // col of the square branched on
+		int nextValue; // next value to try, 10 once every value was tried
+	}; // end SearchFrame
+
+	// branching stack of solveResumable(), empty when no search is running
+	std::vector<SearchFrame> searchStack_;
+	// nodes visited by solveResumable() since the search started
+	long long searchNodes_;
+	// timed checkpoints that could not be written since the search started
+	long failedCheckpoints_;
+
+	// search trace receiving events, nullptr when tracing is disabled
+	SearchTrace* trace_;
 
 	/** Private Methods*/
 
@@ -183,6 +304,11 @@ private:
 	bool fill(const int inputData[]);
 
 
+	/** getSquare
+	@param [square] index of the square, 0 to 80 in row major order
+	@return the Square at [square]*/
+	const Square& getSquare(int square) const;
+
 	/** getOptions get the amount of options for the given sqaure
 	@param [targetRow] and [targetCol], indices of the current sqaure
 	@return the count of options for the given sqaure*/
@@ -195,5 +321,70 @@ private:
 	amount of options by calling getOptions*/
 	void moveToHardestSquare(int& row, int& col);
 
+	/** runSearch, continues the search held in searchStack_
+	@param [checkpointPath], [interval] and [suspend] as for solveResumable()
+	@return Solved, NoSolution, Suspended or SaveFailed */
+	SearchStatus runSearch(const std::string& checkpointPath, long interval, 
+		const std::atomic<bool>* suspend);
+
+	/** traceRestoredStack records the levels of a restored searchStack_ as
+	if they had just been searched, so the trace starts at the right depth
+	@post the board is unchanged, trace_ holds a Choose event per level and
+	a Try event for the value set on every level but the top*/
+	void traceRestoredStack();
+
+	/** writeCheckpoint saves the board, fixed mask and searchStack_
+	@param [checkpointPath] file to write, replaced atomically
+	@return true if the checkpoint was written, false otherwise*/
+	bool writeCheckpoint(const std::string& checkpointPath) const;
+
+	/** readCheckpoint restores the board, fixed mask and searchStack_
+	@param [checkpointPath] file written by writeCheckpoint()
+	@return true if a valid checkpoint was read, false otherwise*/
+	bool readCheckpoint(const std::string& checkpointPath);
+
+	/** removeCheckpoint deletes the checkpoint of a finished search
+	@param [checkpointPath] file written by writeCheckpoint(), may be empty
+	@post no checkpoint is left at [checkpointPath]*/
+	void removeCheckpoint(const std::string& checkpointPath) const;
+
+	/** countCandidates counts the legal values for the given sqaure
+	@param [targetRow] and [targetCol], indices of the current sqaure
+	@return the count of values 1-9 that may be set at the given sqaure*/
+	int countCandidates(int targetRow, int targetCol) const;
+
+	/** moveToSquare Searches for next open space using the
+	cell heuristic of the provided [strategy]
+	@param [strategy] search configuration, [generator] random engine for
+	tie breaks, [row] and [col] passed by reference, indices to update
+	@post updates [row] and [col] to the chosen open space
+	@return false if no open space exists, true otherwise*/
+	bool moveToSquare(const Strategy& strategy, std::mt19937& generator, int& row, int& col) const;
+
+	/** search, single run of the configurable backtracking search
+	@param [strategy] search configuration, [generator] random engine,
+	[nodeBudget] remaining nodes for this run, negative for unlimited,
+	[cancel] optional cancellation flag
+	@post on failure every value set by this run has been removed
+	@return true if puzzle successfully solved, otherwise false */
+	bool search(const Strategy& strategy, std::mt19937& generator, long& nodeBudget, 
+		const std::atomic<bool>* cancel);
+
 }; // end of Puzzle
 
+/** getSquare
+@param [square] index of the square, 0 to 80 in row major order
+@return the Square at [square]*/
+inline const Puzzle::Square& Puzzle::getSquare(int square) const {
+
+	return puzzleStructure_[square];
+
+} // end getSquare
+
+/** getValue
+@return integer value stored in value_*/
+inline int Puzzle::Square::getValue() const {
+
+	return ((value_ > 0) ? value_ : (-1));
+
+} // end of getValue()
@@ -0,0 +1,193 @@
+/** @file SearchTrace.cpp
+ @author agent
+ @date 10/19/2026
+ This is implementation file of the search tree trace for the Puzzle
+	solver, see SearchTrace.h.*/
+
+#include "SearchTrace.h"
+
+#include <map>
+#include <string>
+
+/** SearchTrace Constructor
+@param [capacity] events kept, the oldest events are overwritten once
+the buffer is full*/
+SearchTrace::SearchTrace(size_t capacity)
+:events_((capacity > 0) ? capacity : 1), next_(0), recorded_(0), depth_(0),
+origin_(std::chrono::steady_clock::now()) {
+} // end of Constructor
+
+/** size
+@return the number of events currently held*/
+size_t SearchTrace::size() const {
+
+	return (recorded_ < static_cast<long long>(events_.size())) 
+		? static_cast<size_t>(recorded_) : events_.size();
+
+} // end size
+
+/** dropped
+@return the number of events overwritten since start()*/
+long long SearchTrace::dropped() const {
+
+	return recorded_ - static_cast<long long>(size());
+
+} // end dropped
+
+/** event
+@param [index] position from the oldest held event
+@return the event at [index]*/
+const SearchTrace::Event& SearchTrace::event(size_t index) const {
+
+	// before the buffer wraps the oldest event is at 0, afterwards at next_
+	size_t oldest = (size() < events_.size()) ? 0 : next_;
+	return events_[(oldest + index) % events_.size()];
+
+} // end event
+
+/** writeChromeTrace exports the held events as Chrome trace JSON.
+Every value tried becomes a slice nested under the value of the level
+above, squares chosen become instant events.
+@param [out] stream receiving the JSON document*/
+void SearchTrace::writeChromeTrace(std::ostream& out) const {
+
+	/** Slice struct */
+	struct Slice {
+		bool open; // true while the value is being searched
+		long long start; // time the value was set
+		const Event* tried; // the Try event that opened the slice
+	}; // end Slice
+
+	// open slice per search level
+	std::vector<Slice> slices;
+	bool first = true;
+
+	// writes one event object, prefixing a comma after the first
+	auto begin = [&out, &first]() -> std::ostream& {
+		out << (first ? "\n" : ",\n");
+		first = false;
+		return out;
+	}; // end begin
+
+	// closes every slice at [depth] or deeper at time [nanos]
+	auto closeFrom = [&slices, &begin](size_t depth, long long nanos) {
+		for (size_t level = slices.size(); level-- > depth;) {
+			if (slices[level].open) {
+				const Event& tried = *slices[level].tried;
+				begin() << "{\"name\":\"r" << int(tried.row) << "c" << int(tried.col) << "=" << int(tried.value)
+					<< "\",\"cat\":\"try\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << slices[level].start / 1000.0
+					<< ",\"dur\":" << (nanos - slices[level].start) / 1000.0
+					<< ",\"args\":{\"depth\":" << level << "}}";
+				slices[level].open = false;
+			} // end if
+		} // end for
+	}; // end closeFrom
+
+	out << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":" << dropped() << "},\"traceEvents\":[";
+	// microsecond timestamps with nanosecond digits, the caller's
+	// formatting is restored once the document is written
+	std::ios::fmtflags savedFlags = out.flags();
+	std::streamsize savedPrecision = out.precision();
+	out.setf(std::ios::fixed, std::ios::floatfield);
+	out.precision(3);
+
+	long long last = 0;
+
+	for (size_t i = 0; i < size(); ++i) {
+
+		const Event& current = event(i);
+		last = current.nanos;
+
+		switch (current.type) {
+
+		case EventType::Choose:
+			begin() << "{\"name\":\"choose r" << int(current.row) << "c" << int(current.col)
+				<< "\",\"cat\":\"choose\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":1,\"ts\":" << current.nanos / 1000.0
+				<< ",\"args\":{\"depth\":" << int(current.depth) << ",\"candidates\":" << int(current.value) << "}}";
+			break;
+
+		case EventType::Try:
+			closeFrom(current.depth, current.nanos);
+			if (slices.size() <= current.depth) {
+				slices.resize(current.depth + 1, Slice{ false, 0, nullptr });
+			} // end if
+			slices[current.depth] = Slice{ true, current.nanos, &current };
+			break;
+
+		case EventType::Backtrack:
+			closeFrom(current.depth, current.nanos);
+			begin() << "{\"name\":\"backtrack r" << int(current.row) << "c" << int(current.col)
+				<< "\",\"cat\":\"backtrack\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":1,\"ts\":" << current.nanos / 1000.0
+				<< ",\"args\":{\"depth\":" << int(current.depth) << "}}";
+			break;
+
+		case EventType::Solved:
+			closeFrom(0, current.nanos);
+			begin() << "{\"name\":\"solved\",\"cat\":\"solved\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":1,\"ts\":"
+				<< current.nanos / 1000.0 << "}";
+			break;
+
+		} // end switch
+
+	} // end for
+
+	closeFrom(0, last);
+	out << "\n]}\n";
+	out.flags(savedFlags);
+	out.precision(savedPrecision);
+
+} // end writeChromeTrace
+
+/** writeCollapsedStacks exports the held events as collapsed stacks,
+one line per path of squares, weighted by the values tried on it.
+@param [out] stream receiving the stack lines*/
+void SearchTrace::writeCollapsedStacks(std::ostream& out) const {
+
+	// squares chosen on the current path, one per level
+	std::vector<std::string> path;
+	// values tried per path
+	std::map<std::string, long long> stacks;
+
+	for (size_t i = 0; i < size(); ++i) {
+
+		const Event& current = event(i);
+
+		if (current.type == EventType::Choose) {
+
+			path.resize(current.depth, "dropped");
+			path.push_back("r" + std::to_string(current.row) + "c" + std::to_string(current.col));
+
+		}
+		else if (current.type == EventType::Try) {
+
+			// levels whose Choose was overwritten are marked dropped
+			if (path.size() <= current.depth) {
+				path.resize(current.depth + 1, "dropped");
+			} // end if
+
+			std::string stack = "search";
+			for (size_t level = 0; level <= current.depth; ++level) {
+				stack += ";" + path[level];
+			} // end for
+
+			++stacks[stack];
+
+		} // end if
+
+	} // end for
+
+	for (const auto& stack : stacks) {
+		out << stack.first << " " << stack.second << "\n";
+	} // end for
+
+} // end writeCollapsedStacks
+
+/** start drops all events and restarts the clock*/
+void SearchTrace::start() {
+
+	next_ = 0;
+	recorded_ = 0;
+	depth_ = 0;
+	origin_ = std::chrono::steady_clock::now();
+
+} // end start
@@ -0,0 +1,129 @@
+/** @file SearchTrace.h
+ @author agent
+ @date 10/19/2026
+ This header class file implements a search tree trace for the Puzzle
+	solver. Events are stored in a ring buffer allocated up front and can
+	be exported as Chrome trace JSON, which Perfetto also opens, or as
+	collapsed stacks for flame graph tools.*/
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+class SearchTrace {
+
+public:
+
+	// kinds of search events
+	enum class EventType : unsigned char {
+		Choose,		// a square was chosen, value holds its candidate count
+		Try,		// a legal value was set at the current square
+		Backtrack,	// every value of the current square failed
+		Solved		// no open square is left
+	}; // end EventType
+
+	/** Event struct
+	 one recorded search event*/
+	struct Event {
+		long long nanos; // time since start(), in nanoseconds
+		EventType type; // kind of event
+		unsigned char depth; // search level, 0 for the first square
+		unsigned char row; // row of the square
+		unsigned char col; // col of the square
+		unsigned char value; // value tried, or candidate count for Choose
+	}; // end Event
+
+	/** SearchTrace Constructor
+	@param [capacity] events kept, the oldest events are overwritten once
+	the buffer is full*/
+	explicit SearchTrace(size_t capacity = 1 << 20);
+
+	/** SearchTrace Methods*/
+
+	/** SearchTrace Accessors */
+
+	/** size
+	@return the number of events currently held*/
+	size_t size() const;
+
+	/** dropped
+	@return the number of events overwritten since start()*/
+	long long dropped() const;
+
+	/** event
+	@param [index] position from the oldest held event
+	@return the event at [index]*/
+	const Event& event(size_t index) const;
+
+	/** writeChromeTrace exports the held events as Chrome trace JSON.
+	Every value tried becomes a slice nested under the value of the level
+	above, squares chosen become instant events.
+	@param [out] stream receiving the JSON document*/
+	void writeChromeTrace(std::ostream& out) const;
+
+	/** writeCollapsedStacks exports the held events as collapsed stacks,
+	one line per path of squares, weighted by the values tried on it.
+	@param [out] stream receiving the stack lines*/
+	void writeCollapsedStacks(std::ostream& out) const;
+
+	/** SearchTrace Mutators */
+
+	/** start drops all events and restarts the clock*/
+	void start();
+
+	/** record stores an event at the current search level
+	@param [type] kind of event, [row] and [col] the square,
+	[value] value tried, or candidate count for Choose*/
+	void record(EventType type, int row, int col, int value);
+
+private:
+
+	/** SearchTrace attributes*/
+
+	// ring buffer, allocated by the constructor
+	std::vector<Event> events_;
+	// index the next event is written to
+	size_t next_;
+	// events recorded since start()
+	long long recorded_;
+	// current search level
+	int depth_;
+	// time of start()
+	std::chrono::steady_clock::time_point origin_;
+
+}; // end of SearchTrace
+
+/** record stores an event at the current search level
+@param [type] kind of event, [row] and [col] the square,
+[value] value tried, or candidate count for Choose*/
+inline void SearchTrace::record(EventType type, int row, int col, int value) {
+
+	// leaving a level, the event belongs to the level it closes
+	if (type == EventType::Backtrack && depth_ > 0) {
+		--depth_;
+	} // end if
+
+	Event& slot = events_[next_];
+	slot.nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - origin_).count();
+	slot.type = type;
+	// a value is tried at the level of the square chosen before it
+	slot.depth = static_cast<unsigned char>((type == EventType::Try && depth_ > 0) ? depth_ - 1 : depth_);
+	slot.row = static_cast<unsigned char>(row);
+	slot.col = static_cast<unsigned char>(col);
+	slot.value = static_cast<unsigned char>(value);
+
+	next_ = (next_ + 1 == events_.size()) ? 0 : next_ + 1;
+	++recorded_;
+
+	// entering a level, a solved search returns to the top
+	if (type == EventType::Choose) {
+		++depth_;
+	}
+	else if (type == EventType::Solved) {
+		depth_ = 0;
+	} // end if
+
+} // end record
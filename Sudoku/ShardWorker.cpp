@@ -0,0 +1,232 @@
+/** @file ShardWorker.cpp
+ @author agent
+ @date 10/19/2026
+ This is implementation file of the worker side of the batch solving
+	protocol, see ShardWorker.h for the message format.*/
+
+#include "ShardWorker.h"
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "Puzzle.h"
+#include "PortfolioSolver.h"
+#include "BatchPropagator.h"
+#include "BatchWriter.h"
+#include "BoardFormatter.h"
+
+/** overloaded += adds the counters of [rhs] to this object
+@param [rhs] statistics to add
+@return this object*/
+ShardStatistics& ShardStatistics::operator+=(const ShardStatistics& rhs) {
+
+	records += rhs.records;
+	solved += rhs.solved;
+	unsolvable += rhs.unsolvable;
+	invalid += rhs.invalid;
+	micros += rhs.micros;
+
+	return *this;
+
+} // end overloaded +=
+
+/** ShardWorker Constructor
+@param [usePortfolio] solve with the PortfolioSolver instead of the
+classic search*/
+ShardWorker::ShardWorker(bool usePortfolio)
+:usePortfolio_(usePortfolio) {
+} // end of Constructor
+
+/** run, answers SHARD requests read from [input] until end of stream
+@param [input] request stream, [output] reply stream
+@post a reply has been written to [output] for every request
+@return 0 if every request was answered, 1 if a request was malformed
+or its corpus could not be opened*/
+int ShardWorker::run(std::istream& input, std::ostream& output) const {
+
+	std::string request;
+
+	while (std::getline(input, request)) {
+
+		std::istringstream fields(request);
+		std::string command;
+		long id = 0;
+		long long begin = 0;
+		long long end = 0;
+		std::string path;
+
+		fields >> command >> id >> begin >> end;
+		// the path is the rest of the line and may contain spaces
+		fields >> std::ws;
+		std::getline(fields, path);
+
+		if (!fields.eof() || command != "SHARD" || path.empty()) {
+			std::cerr << "Malformed shard request: " << request << std::endl;
+			return 1;
+		} // end if
+
+		std::ifstream corpus(path, std::ios::binary);
+		if (!corpus) {
+			std::cerr << "Cannot open corpus: " << path << std::endl;
+			return 1;
+		} // end if
+
+		output << "RESULT " << id << "\n";
+		ShardStatistics stats = solveShard(path, begin, end, output);
+		output << "END " << id << " " << stats.records << " " << stats.solved << " "
+			<< stats.unsolvable << " " << stats.invalid << " " << stats.micros << std::endl;
+
+	} // end while
+
+	return 0;
+
+} // end run
+
+/** solveShard, solves every record of a corpus byte range
+@param [path] corpus file, [begin] and [end] byte range of the shard,
+[output] stream that receives one result line per record
+@pre [path] names a readable corpus
+@post result lines have been written to [output] in record order
+@return statistics for the shard*/
+ShardStatistics ShardWorker::solveShard(const std::string& path, long long begin, long long end, 
+	std::ostream& output) const {
+
+	ShardStatistics stats;
+	std::ifstream corpus(path, std::ios::binary);
+	std::string record;
+	// result lines, passed to output in large writes
+	BatchWriter writer(output);
+
+	// a record that starts before begin belongs to the previous shard,
+	// step back one byte and skip to the start of the next line
+	if (begin > 0) {
+		corpus.seekg(begin - 1);
+		std::getline(corpus, record);
+	} // end if
+
+	// records waiting to be solved together
+	std::vector<std::string> batch;
+
+	while (corpus) {
+
+		long long start = static_cast<long long>(corpus.tellg());
+		if (start < 0 || start >= end || !std::getline(corpus, record)) {
+			break; // record belongs to the next shard
+		} // end if
+
+		// skip blank lines
+		if (record.find_first_not_of(" \t\r") == std::string::npos) {
+			continue;
+		} // end if
+
+		batch.push_back(record);
+
+		if (static_cast<int>(batch.size()) == BatchPropagator::laneCount) {
+			solveBatch(batch, writer, stats);
+			batch.clear();
+		} // end if
+
+	} // end while
+
+	solveBatch(batch, writer, stats);
+
+	return stats;
+
+} // end solveShard
+
+/** solveBatch, solves up to BatchPropagator::laneCount records together.
+Singles are propagated on every valid record at once, and only the
+records propagation could not finish go through the scalar search.
+@param [records] corpus lines to solve, [writer] receives one result
+line per record in order, [stats] counters to update*/
+void ShardWorker::solveBatch(const std::vector<std::string>& records, BatchWriter& writer, 
+	ShardStatistics& stats) const {
+
+	if (records.empty()) {
+		return;
+	} // end if
+
+	int count = static_cast<int>(records.size());
+	std::vector<Puzzle> puzzles(records.size());
+	// input boards, kept for unsolvable records
+	std::vector<char> boards(records.size() * BoardFormatter::compactSize);
+	std::vector<char> valid(records.size(), false);
+	// valid puzzles in lane order
+	std::vector<Puzzle*> lanes;
+	std::vector<int> laneRecord;
+
+	for (int i = 0; i < count; ++i) {
+
+		++stats.records;
+
+		try {
+
+			std::istringstream recordStream(records[i]);
+			recordStream >> puzzles[i];
+			BoardFormatter::formatCompact(puzzles[i], &boards[i * BoardFormatter::compactSize]);
+			valid[i] = true;
+			lanes.push_back(&puzzles[i]);
+			laneRecord.push_back(i);
+
+		}
+		catch (const std::runtime_error&) {
+			++stats.invalid;
+		} // end try
+
+	} // end for
+
+	auto startTime = std::chrono::steady_clock::now();
+
+	BatchPropagator propagator;
+	propagator.load(lanes.data(), static_cast<int>(lanes.size()));
+	propagator.propagate();
+	propagator.store();
+
+	std::vector<char> solved(records.size(), false);
+
+	for (int lane = 0; lane < static_cast<int>(lanes.size()); ++lane) {
+
+		int i = laneRecord[lane];
+		BatchPropagator::LaneStatus status = propagator.status(lane);
+
+		if (status == BatchPropagator::LaneStatus::Solved) {
+			solved[i] = true;
+		}
+		else if (status == BatchPropagator::LaneStatus::NeedsSearch) {
+
+			if (usePortfolio_) {
+				PortfolioSolver portfolio;
+				solved[i] = portfolio.solve(puzzles[i]);
+			}
+			else {
+				solved[i] = puzzles[i].solve();
+			} // end if
+
+		} // end if
+
+	} // end for
+
+	auto stopTime = std::chrono::steady_clock::now();
+	stats.micros += std::chrono::duration_cast<std::chrono::microseconds>(stopTime - startTime).count();
+
+	// result lines in record order
+	for (int i = 0; i < count; ++i) {
+
+		if (!valid[i]) {
+			writer.write("invalid -\n", 10);
+		}
+		else if (solved[i]) {
+			++stats.solved;
+			writer.write("solved ", 7);
+			writer.writeCompact(puzzles[i]);
+		}
+		else {
+			++stats.unsolvable;
+			writer.write("unsolvable ", 11);
+			writer.write(&boards[i * BoardFormatter::compactSize], BoardFormatter::compactSize);
+		} // end if
+
+	} // end for
+
+} // end solveBatch
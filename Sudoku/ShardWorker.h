@@ -0,0 +1,88 @@
+/** @file ShardWorker.h
+ @author agent
+ @date 10/19/2026
+ This header class file implements the worker side of the batch
+	solving protocol. A worker reads shard requests, solves every puzzle
+	record in the requested byte range of the corpus and reports ordered
+	results and statistics back to its coordinator.
+
+ Protocol, one request or reply per line:
+	request:	SHARD <id> <begin> <end> <path>
+	reply:		RESULT <id>
+				<status> <board>			one line per record, in order
+				END <id> <records> <solved> <unsolvable> <invalid> <micros>
+ status is solved, unsolvable or invalid. board is the 81 digit solution
+ when solved, the 81 digit input when unsolvable and - when invalid.
+ A record is a non blank line. A record belongs to the shard holding its
+ first byte, so byte ranges may be cut anywhere in the corpus.*/
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+class BatchWriter;
+
+/** ShardStatistics struct
+ counters reported for each shard and aggregated by the Coordinator*/
+struct ShardStatistics {
+
+	long records = 0; // non blank lines read
+	long solved = 0; // records solved
+	long unsolvable = 0; // valid records without a solution
+	long invalid = 0; // records that could not be read as a Puzzle
+	long long micros = 0; // time spent solving, in microseconds
+
+	/** overloaded += adds the counters of [rhs] to this object
+	@param [rhs] statistics to add
+	@return this object*/
+	ShardStatistics& operator+=(const ShardStatistics& rhs);
+
+}; // end ShardStatistics
+
+class ShardWorker {
+
+public:
+
+	/** ShardWorker Constructor
+	@param [usePortfolio] solve with the PortfolioSolver instead of the
+	classic search*/
+	explicit ShardWorker(bool usePortfolio = false);
+
+	/** ShardWorker Methods*/
+
+	/** run, answers SHARD requests read from [input] until end of stream
+	@param [input] request stream, [output] reply stream
+	@post a reply has been written to [output] for every request
+	@return 0 if every request was answered, 1 if a request was malformed
+	or its corpus could not be opened*/
+	int run(std::istream& input, std::ostream& output) const;
+
+	/** solveShard, solves every record of a corpus byte range
+	@param [path] corpus file, [begin] and [end] byte range of the shard,
+	[output] stream that receives one result line per record
+	@pre [path] names a readable corpus
+	@post result lines have been written to [output] in record order
+	@return statistics for the shard*/
+	ShardStatistics solveShard(const std::string& path, long long begin, long long end, 
+		std::ostream& output) const;
+
+private:
+
+	/** ShardWorker attributes*/
+
+	// solve with the PortfolioSolver instead of Puzzle::solve()
+	bool usePortfolio_;
+
+	/** Private Methods*/
+
+	/** solveBatch, solves up to BatchPropagator::laneCount records together.
+	Singles are propagated on every valid record at once, and only the
+	records propagation could not finish go through the scalar search.
+	@param [records] corpus lines to solve, [writer] receives one result
+	line per record in order, [stats] counters to update*/
+	void solveBatch(const std::vector<std::string>& records, BatchWriter& writer, 
+		ShardStatistics& stats) const;
+
+}; // end of ShardWorker
@@ -0,0 +1,107 @@
+/** @file SudokuTables.h
+ @author agent
+ @date 10/19/2026
+ This header file builds the lookup tables of the 9-by-9 Sudoku grid at
+	compile time. Squares are numbered 0 to 80 in row major order. The 27
+	units are the 9 rows, then the 9 columns, then the 9 3-by-3 blocks.
+	The peers of a square are the 20 other squares sharing a unit with it.*/
+
+#pragma once
+
+// asks the compiler to fully unroll the fixed length table loop that
+// follows, the peer and unit loops are short enough to become straight
+// line loads. Other compilers unroll as they see fit
+#if defined(__clang__)
+#define SUDOKU_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define SUDOKU_UNROLL _Pragma("GCC unroll 20")
+#else
+#define SUDOKU_UNROLL
+#endif
+
+/** SudokuTables struct
+ compile time lookup tables, see sudokuTables below*/
+struct SudokuTables {
+
+	// squares in the grid
+	static constexpr int squareCount = 81;
+	// rows, columns and blocks
+	static constexpr int unitCount = 27;
+	// squares in each unit
+	static constexpr int unitSize = 9;
+	// units each square belongs to, its row, column and block
+	static constexpr int unitsPerSquare = 3;
+	// squares sharing a unit with each square
+	static constexpr int peerCount = 20;
+
+	// squares of each unit
+	unsigned char unit[unitCount][unitSize];
+	// row, column and block unit of each square
+	unsigned char unitsOf[squareCount][unitsPerSquare];
+	// peers of each square
+	unsigned char peers[squareCount][peerCount];
+
+}; // end SudokuTables
+
+/** makeSudokuTables builds the lookup tables
+@return the filled tables*/
+constexpr SudokuTables makeSudokuTables() {
+
+	SudokuTables tables{};
+
+	for (int square = 0; square < SudokuTables::squareCount; ++square) {
+
+		int row = square / 9;
+		int col = square % 9;
+		int box = (row / 3) * 3 + col / 3;
+
+		tables.unitsOf[square][0] = static_cast<unsigned char>(row);
+		tables.unitsOf[square][1] = static_cast<unsigned char>(9 + col);
+		tables.unitsOf[square][2] = static_cast<unsigned char>(18 + box);
+
+	} // end for
+
+	for (int i = 0; i < SudokuTables::unitSize; ++i) {
+
+		for (int j = 0; j < SudokuTables::unitSize; ++j) {
+
+			// row i, column i and block i
+			tables.unit[i][j] = static_cast<unsigned char>(i * 9 + j);
+			tables.unit[9 + i][j] = static_cast<unsigned char>(j * 9 + i);
+			tables.unit[18 + i][j] = static_cast<unsigned char>(((i / 3) * 3 + j / 3) * 9 + (i % 3) * 3 + j % 3);
+
+		} // end for
+
+	} // end for
+
+	for (int square = 0; square < SudokuTables::squareCount; ++square) {
+
+		int count = 0;
+
+		for (int other = 0; other < SudokuTables::squareCount; ++other) {
+
+			bool sameRow = square / 9 == other / 9;
+			bool sameCol = square % 9 == other % 9;
+			bool sameBox = tables.unitsOf[square][2] == tables.unitsOf[other][2];
+
+			if (other != square && (sameRow || sameCol || sameBox)) {
+				tables.peers[square][count] = static_cast<unsigned char>(other);
+				++count;
+			} // end if
+
+		} // end for
+
+	} // end for
+
+	return tables;
+
+} // end makeSudokuTables
+
+// the lookup tables, built by the compiler. A namespace scope constexpr
+// variable has internal linkage, so every translation unit holds its own
+// copy and the header stays valid C++14
+constexpr SudokuTables sudokuTables = makeSudokuTables();
+
+static_assert(sudokuTables.unitsOf[80][2] == 26 && sudokuTables.unitsOf[30][2] == 22, "unit index table is wrong");
+static_assert(sudokuTables.unit[26][8] == 80 && sudokuTables.unit[10][1] == 10, "unit table is wrong");
+static_assert(sudokuTables.peers[0][19] == 72 && sudokuTables.peers[80][0] == 8, "peer table is wrong");
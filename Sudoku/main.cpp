@@ -2,14 +2,296 @@
  @author Anthony Campos
  @date 11/15/2021
  This is the driver cpp file to run the Sudoku
- Puzzle game.*/
+ Puzzle game.
+
+ Usage: main [--portfolio] [--coordinator corpus [--workers n]
+			[--shard-records n | --shard-bytes n] [--worker-program file]]
+			[--worker]
+			[--checkpoint file [--checkpoint-interval n]] [--resume file]
+			[--trace file] [--trace-stacks file]
+	--portfolio		solve each puzzle with the PortfolioSolver, racing
+					several search strategies in parallel
+	--coordinator	solve every line of corpus in worker processes and
+					write the ordered results to stdout, statistics to stderr
+	--workers		number of concurrent worker processes, default 4
+	--shard-records	records per shard, default 1000
+	--shard-bytes	bytes per shard, replaces --shard-records
+	--worker-program
+					program started as the workers, default this program,
+					see tests/coordinator_crash_test.sh
+	--worker		answer shard requests on stdin, see ShardWorker.h
+	--checkpoint	save the search state of each puzzle to this file on
+					SIGINT or SIGTERM and stop, see Puzzle::solveResumable()
+	--checkpoint-interval
+					also save the search state every n search nodes
+	--resume		continue the search saved in this checkpoint file
+	--trace			write a Chrome trace JSON of every search to this file,
+					not available with --portfolio, --worker or --coordinator
+	--trace-stacks	write collapsed stacks of every search to this file,
+					with the same restriction as --trace*/
 
 #include <iostream>
 #include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
 #include "Puzzle.h"
+#include "PortfolioSolver.h"
+#include "Coordinator.h"
+#include "ShardWorker.h"
+#include "SearchTrace.h"
+
+#include <atomic>
+#include <csignal>
+#include <memory>
+
+// set by SIGINT or SIGTERM, suspends a resumable search
+static std::atomic<bool> suspendRequested{ false };
+
+/** requestSuspend signal handler, asks the running search to save its
+ state and stop
+ @param [signal] the signal received*/
+extern "C" void requestSuspend(int) {
+
+	suspendRequested.store(true);
+
+} // end requestSuspend
+
+/** catchSuspendSignals routes SIGINT and SIGTERM to requestSuspend while
+ a resumable search runs, and back to their previous handlers afterwards
+ @param [enable] true before the search starts, false once it returns
+ @post when enabling, any earlier suspend request has been forgotten*/
+static void catchSuspendSignals(bool enable) {
+
+	// handlers in place before the search, SIG_DFL unless inherited otherwise
+	static void (*previousInterrupt)(int) = SIG_DFL;
+	static void (*previousTerminate)(int) = SIG_DFL;
+
+	if (enable) {
+		suspendRequested.store(false);
+		previousInterrupt = std::signal(SIGINT, requestSuspend);
+		previousTerminate = std::signal(SIGTERM, requestSuspend);
+	}
+	else {
+		std::signal(SIGINT, previousInterrupt);
+		std::signal(SIGTERM, previousTerminate);
+	} // end if
+
+} // end catchSuspendSignals
+
+/** writeTrace exports the events of a search trace
+ @param [trace] trace to export, nothing is written if nullptr,
+ [chromePath] Chrome trace JSON file and [stacksPath] collapsed stacks
+ file, each skipped if empty*/
+static void writeTrace(const SearchTrace* trace, const std::string& chromePath, const std::string& stacksPath) {
+
+	if (trace == nullptr) {
+		return;
+	} // end if
+
+	if (!chromePath.empty()) {
+		std::ofstream chromeFile(chromePath);
+		trace->writeChromeTrace(chromeFile);
+	} // end if
+
+	if (!stacksPath.empty()) {
+		std::ofstream stacksFile(stacksPath);
+		trace->writeCollapsedStacks(stacksFile);
+	} // end if
+
+	if (trace->dropped() > 0) {
+		std::cerr << "Trace buffer full, " << trace->dropped() << " oldest events dropped" << std::endl;
+	} // end if
+
+} // end writeTrace
+
+/** reportResumable displays the outcome of a resumable search
+ @param [status] result of the search, [puzzle] the searched puzzle,
+ [checkpointPath] file holding the state of a suspended search
+ @return exit code, 0 unless the search was suspended (2) or its state
+ could not be saved (1)*/
+static int reportResumable(Puzzle::SearchStatus status, const Puzzle& puzzle, const std::string& checkpointPath) {
+
+	if (puzzle.failedCheckpoints() > 0) {
+		std::cerr << puzzle.failedCheckpoints() << " timed checkpoints could not be written to "
+			<< checkpointPath << std::endl;
+	} // end if
+
+	if (status == Puzzle::SearchStatus::Solved) {
+		std::cout << "\n\n" << puzzle << std::endl;
+		std::cout << "\nSize: " << puzzle.size() << ", Open Blank Spaces: " << puzzle.numEmpty() << std::endl;
+	}
+	else if (status == Puzzle::SearchStatus::NoSolution) {
+		std::cout << "The provided puzzle could not be solved by the system!" << std::endl;
+	}
+	else if (status == Puzzle::SearchStatus::SaveFailed) {
+		std::cerr << "Search stopped, the checkpoint could not be written to " << checkpointPath << std::endl;
+		return 1;
+	}
+	else {
+		std::cout << "Search suspended, resume with --resume " << checkpointPath << std::endl;
+		return 2;
+	} // end if
 
+	return 0;
 
-int main() {
+} // end reportResumable
+
+
+int main(int argc, char* argv[]) {
+
+	// solve with the parallel portfolio instead of the classic search
+	bool usePortfolio = false;
+	// answer shard requests from a coordinator
+	bool runWorker = false;
+	// corpus to solve in coordinator mode, empty for the interactive game
+	std::string corpusPath;
+	int workers = 4;
+	long shardRecords = 1000;
+	long long shardBytes = 0;
+	// program run in worker mode, empty for this program
+	std::string workerProgram;
+	// file receiving the state of a resumable search, empty for none
+	std::string checkpointPath;
+	long checkpointInterval = 0;
+	// checkpoint to continue instead of playing
+	std::string resumePath;
+	// trace exports, empty for none
+	std::string tracePath;
+	std::string stacksPath;
+
+	for (int arg = 1; arg < argc; ++arg) {
+
+		std::string option = argv[arg];
+		// options that take a value
+		bool hasValue = arg + 1 < argc;
+
+		if (option == "--portfolio") {
+			usePortfolio = true;
+		}
+		else if (option == "--worker") {
+			runWorker = true;
+		}
+		else if (option == "--coordinator" && hasValue) {
+			corpusPath = argv[++arg];
+		}
+		else if (option == "--workers" && hasValue) {
+			workers = std::atoi(argv[++arg]);
+		}
+		else if (option == "--shard-records" && hasValue) {
+			shardRecords = std::atol(argv[++arg]);
+		}
+		else if (option == "--shard-bytes" && hasValue) {
+			shardBytes = std::atoll(argv[++arg]);
+		}
+		else if (option == "--worker-program" && hasValue) {
+			workerProgram = argv[++arg];
+		}
+		else if (option == "--checkpoint" && hasValue) {
+			checkpointPath = argv[++arg];
+		}
+		else if (option == "--checkpoint-interval" && hasValue) {
+			checkpointInterval = std::atol(argv[++arg]);
+		}
+		else if (option == "--resume" && hasValue) {
+			resumePath = argv[++arg];
+		}
+		else if (option == "--trace" && hasValue) {
+			tracePath = argv[++arg];
+		}
+		else if (option == "--trace-stacks" && hasValue) {
+			stacksPath = argv[++arg];
+		}
+		else {
+			std::cerr << "Unknown option: " << argv[arg] << std::endl;
+			return 1;
+		} // end if
+
+	} // end for
+
+	// tracing is only paid for when an export was asked for
+	std::unique_ptr<SearchTrace> trace;
+	if (!tracePath.empty() || !stacksPath.empty()) {
+
+		// only the single threaded searches of this process are traced
+		if (usePortfolio || runWorker || !corpusPath.empty()) {
+			std::cerr << "--trace and --trace-stacks cannot be combined with "
+				<< "--portfolio, --worker or --coordinator" << std::endl;
+			return 1;
+		} // end if
+
+		trace.reset(new SearchTrace());
+
+	} // end if
+
+	if (!resumePath.empty()) {
+
+		Puzzle puzzleObj;
+		puzzleObj.setTrace(trace.get());
+
+		try {
+			std::cout << "Resuming " << resumePath << "..." << std::endl;
+			// preemption saves the search state instead of losing it
+			catchSuspendSignals(true);
+			Puzzle::SearchStatus status = puzzleObj.resume(resumePath, checkpointInterval, &suspendRequested);
+			catchSuspendSignals(false);
+			writeTrace(trace.get(), tracePath, stacksPath);
+			return reportResumable(status, puzzleObj, resumePath);
+		}
+		catch (const std::runtime_error& err) {
+			catchSuspendSignals(false);
+			std::cerr << err.what() << std::endl;
+			return 1;
+		} // end try
+
+	} // end if
+
+	if (runWorker) {
+
+		ShardWorker worker(usePortfolio);
+		return worker.run(std::cin, std::cout);
+
+	} // end if
+
+	if (!corpusPath.empty()) {
+
+#if !SUDOKU_HAS_PROCESSES
+		std::cerr << "--coordinator needs a POSIX system to start worker processes" << std::endl;
+		return 1;
+#else
+		if (!std::ifstream(corpusPath)) {
+			std::cerr << "Cannot open corpus: " << corpusPath << std::endl;
+			return 1;
+		} // end if
+
+		// workers are this program started in worker mode unless replaced
+		std::vector<std::string> workerCommand{
+			workerProgram.empty() ? argv[0] : workerProgram, "--worker" };
+		if (usePortfolio) {
+			workerCommand.push_back("--portfolio");
+		} // end if
+
+		Coordinator coordinator(workerCommand);
+		coordinator.setWorkers(workers);
+
+		std::vector<Coordinator::Shard> shards = (shardBytes > 0)
+			? Coordinator::shardByBytes(corpusPath, shardBytes)
+			: Coordinator::shardByRecords(corpusPath, shardRecords);
+
+		bool success = coordinator.run(corpusPath, shards, std::cout);
+
+		// aggregate statistics
+		const ShardStatistics& stats = coordinator.statistics();
+		std::cerr << "Shards: " << shards.size() << ", Retries: " << coordinator.retries()
+			<< ", Records: " << stats.records << ", Solved: " << stats.solved
+			<< ", Unsolvable: " << stats.unsolvable << ", Invalid: " << stats.invalid
+			<< ", Solve Time: " << stats.micros << " microseconds" << std::endl;
+
+		return success ? 0 : 1;
+#endif
+
+	} // end if
 
 	// introduction to the program
 	std::cout << "\n=============== Let's solve some Sudoku Puzzle ===============" << std::endl;
@@ -30,6 +312,7 @@ int main() {
 
 		// Puzzle object
 		Puzzle puzzleObj;
+		puzzleObj.setTrace(trace.get());
 
 		try {
 			// get puzle from user
@@ -44,7 +327,36 @@ int main() {
 			// begin solving timer
 			auto start = std::chrono::high_resolution_clock::now();
 
-			if (puzzleObj.solve()) {
+			if (!checkpointPath.empty()) {
+
+				// preemption saves the search state instead of losing it
+				catchSuspendSignals(true);
+				Puzzle::SearchStatus status = puzzleObj.solveResumable(checkpointPath, checkpointInterval, 
+					&suspendRequested);
+				catchSuspendSignals(false);
+
+				// a suspended search ends the session
+				int exitCode = reportResumable(status, puzzleObj, checkpointPath);
+				if (exitCode != 0) {
+					writeTrace(trace.get(), tracePath, stacksPath);
+					return exitCode;
+				} // end if
+
+				continue;
+
+			} // end if
+
+			bool solved = false;
+
+			if (usePortfolio) {
+				PortfolioSolver portfolio;
+				solved = portfolio.solve(puzzleObj);
+			}
+			else {
+				solved = puzzleObj.solve();
+			} // end if
+
+			if (solved) {
 
 				//  calculate time it took to solve puzzle
 				auto stop = std::chrono::high_resolution_clock::now();
@@ -73,6 +385,8 @@ int main() {
 
 	} // end for
 
+	writeTrace(trace.get(), tracePath, stacksPath);
+
 	std::cout << "\nThank you for playing. Have a wonderful day!" << std::endl;
 	
-} // end main
\ No newline at end of file
+} // end main
\ No newline at end of file
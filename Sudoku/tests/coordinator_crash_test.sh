@@ -0,0 +1,76 @@
+#!/bin/sh
+# coordinator_crash_test.sh
+# Runs the coordinator against a worker that is killed on its first request
+# for one shard and checks that the shard is retried and the output is
+# unchanged. Runs it again against a worker that always crashes on that shard
+# and checks that the coordinator gives up and fails.
+#
+# Usage: tests/coordinator_crash_test.sh [sudoku program]
+# Without a program, the sources next to this script are built first.
+
+set -u
+
+here=$(cd "$(dirname "$0")" && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+if [ $# -ge 1 ]; then
+	sudoku=$1
+else
+	sudoku=$work/sudoku
+	${CXX:-c++} -std=c++14 -O2 -pthread -o "$sudoku" "$here"/../*.cpp || exit 1
+fi
+
+corpus=$here/../"Test Cases.txt"
+
+# stand in worker: kills itself instead of answering shard CRASH_SHARD,
+# once when the marker directory can still be created, always when
+# CRASH_ALWAYS is set
+cat > "$work/worker.sh" <<'WORKER'
+#!/bin/sh
+read -r request
+set -- $request
+if [ "$2" = "$CRASH_SHARD" ]; then
+	if [ -n "${CRASH_ALWAYS:-}" ] || mkdir "$CRASH_MARKER" 2>/dev/null; then
+		kill -KILL $$
+	fi
+fi
+printf '%s\n' "$request" | exec "$SUDOKU" --worker
+WORKER
+chmod +x "$work/worker.sh"
+
+export SUDOKU="$sudoku" CRASH_SHARD=1 CRASH_MARKER="$work/crashed"
+options="--workers 2 --shard-records 8"
+failed=0
+
+"$sudoku" --coordinator "$corpus" $options > "$work/expected" 2> /dev/null
+if [ $? -ne 0 ]; then
+	echo "FAIL: coordinator without crashes"
+	exit 1
+fi
+
+"$sudoku" --coordinator "$corpus" $options --worker-program "$work/worker.sh" \
+	> "$work/actual" 2> "$work/stats"
+if [ $? -ne 0 ]; then
+	echo "FAIL: coordinator did not recover from a crashed worker"
+	failed=1
+elif ! cmp -s "$work/expected" "$work/actual"; then
+	echo "FAIL: output changed after a crashed worker"
+	failed=1
+elif ! grep -q "Retries: 1," "$work/stats"; then
+	echo "FAIL: crashed shard was not retried exactly once"
+	failed=1
+else
+	echo "PASS: crashed shard retried"
+fi
+
+CRASH_ALWAYS=1 "$sudoku" --coordinator "$corpus" $options \
+	--worker-program "$work/worker.sh" > /dev/null 2>&1
+if [ $? -eq 0 ]; then
+	echo "FAIL: coordinator succeeded although a shard always crashes"
+	failed=1
+else
+	echo "PASS: shard that always crashes fails the run"
+fi
+
+exit $failed